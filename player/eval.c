@@ -6,7 +6,6 @@
 #include <stdio.h>
 #include <math.h>
 #include "./tbassert.h"
-#include "./precomp_tables.h"
 
 // -----------------------------------------------------------------------------
 // Evaluation
@@ -38,12 +37,7 @@ bool inRange(const int min, const int max, const int val);
 
 // PCENTRAL heuristic: Bonus for Pawn near center of board
 ev_score_t pcentral(const fil_t f, const rnk_t r) {
-  int df = BOARD_WIDTH/2 - f -1;
-  if (df < 0)  df = f - BOARD_WIDTH/2;
-  int dr  = BOARD_WIDTH/2 - r -1;
-  if (dr < 0) dr = r - BOARD_WIDTH/2;
-  const double bonus = 1 - sqrt(df * df + dr * dr)*BONUS_MULTIPLIER;
-  return PCENTRAL * bonus;
+  return PCENTRAL * pcentral_table[f][r];
 }
 
 
@@ -285,6 +279,42 @@ heuristics_t * mark_laser_path_heuristics(position_t *p, const color_t c, heuris
   }
 }
 
+#if USE_BITBOARDS
+// Bitboard version of mark_laser_path_heuristics.  Reads the laser of c cached
+// in the position instead of walking it.  The cache holds each square once,
+// so a laser that crosses a square twice, which the walk counts twice, is
+// walked after all; such lasers are rare.
+heuristics_t * laser_heuristics(position_t *p, const color_t c, heuristics_t * heuristics) {
+  if (p->laser_crossed[c]) {
+    return mark_laser_path_heuristics(p, c, heuristics);
+  }
+  const color_t o = opp_color(c);
+  const square_t king_sq = p->kloc[o];
+  const bitboard_t path = p->laser[c];
+
+  // MOBILITY: squares of the board around (and under) the enemy king that
+  // the laser does not cover.
+  bitboard_t box = bb_of(king_sq);
+  for (uint8_t d = 0; d < 8; ++d) {
+    square_t new_sq = king_sq + dir_of(d);
+    if (ptype_of(p->board[new_sq]) != INVALID) {
+      box |= bb_of(new_sq);
+    }
+  }
+  heuristics->mobility = bb_popcount(box & ~path);
+
+  // PAWNPIN: enemy pawns on the path.
+  heuristics->pawnpin = bb_popcount(path & p->occ[o] & ~bb_of(king_sq));
+
+  float h_attackable = 0;
+  for (bitboard_t rest = path; rest != 0; rest &= rest - 1) {
+    h_attackable += h_dist(square_of_bit(bb_lsb(rest)), king_sq);
+  }
+  heuristics->h_attackable = h_attackable;
+  return heuristics;
+}
+#endif
+
 // Static evaluation.  Returns score
 score_t eval(position_t *p, const bool verbose) {
   // seed rand_r with a value of 1, as per
@@ -357,8 +387,13 @@ score_t eval(position_t *p, const bool verbose) {
   heuristics_t * b_heuristics = &black_heuristics;
   
   // Calculate the heurisitics for the white and black color
+#if USE_BITBOARDS
+  laser_heuristics(p, BLACK, w_heuristics);
+  laser_heuristics(p, WHITE, b_heuristics);
+#else
   mark_laser_path_heuristics(p, BLACK, w_heuristics);
   mark_laser_path_heuristics(p, WHITE, b_heuristics);
+#endif
 
   const ev_score_t w_hattackable = HATTACK * b_heuristics->h_attackable;
   score[WHITE] += w_hattackable;
@@ -336,7 +336,7 @@ int fen_to_pos(position_t *p, char *fen) {
 
 
   if (fen[0] == '\0') {  // Empty FEN => use starting position
-    fen = "ss3nw5/3nw2nw3/2nw7/1nw6SE1/nw9/9SE/1nw6SE1/7SE2/3SE2SE3/5SE3NN W";
+    fen = START_FEN;
   }
 
   int c_count = 0;  // Invariant: fen[c_count] is next char to be read
@@ -386,6 +386,7 @@ int fen_to_pos(position_t *p, char *fen) {
     fen_error(fen, c_count, "Too many Black Kings");
     return 1;
   }
+  compute_bitboards(p);  // the lasers need both Kings
 
   char c;
   bool done = false;
@@ -427,7 +428,7 @@ int fen_to_pos(position_t *p, char *fen) {
   }
   if (lm_from_sq == 0) {   // from-square of last move
     p->last_move = 0;  // no last move specified
-    p->key = compute_zob_key(p);
+    compute_keys(p);
     return 0;
   }
 
@@ -458,7 +459,7 @@ int fen_to_pos(position_t *p, char *fen) {
       break;
   }
   p->last_move = move_of(EMPTY, lm_rot, lm_from_sq, lm_to_sq);
-  p->key = compute_zob_key(p);
+  compute_keys(p);
 
   return 0;  // everything is okay
 }
@@ -483,7 +484,7 @@ int pos_to_fen(position_t *p, char *fen) {
   int pos = 0;
   int i;
 
-  for (rnk_t r = BOARD_WIDTH - 1; r >=0 ; --r) {
+  for (int r = BOARD_WIDTH - 1; r >= 0; --r) {
     int empty_in_a_row = 0;
     for (fil_t f = 0; f < BOARD_WIDTH; ++f) {
       square_t sq = square_of(f, r);
@@ -524,8 +525,29 @@ int pos_to_fen(position_t *p, char *fen) {
     if (r) fen[pos++] = '/';
   }
   fen[pos++] = ' ';
-  fen[pos++] = 'W';
+  fen[pos++] = color_to_move_of(p) == WHITE ? 'W' : 'B';
   fen[pos++] = '\0';
 
   return pos;
 }
+
+// Translate a fen string into a packed position.  Returns nonzero on a
+// parse error.
+int fen_to_packed(char *fen, packed_position_t *pp) {
+  position_t p;
+  if (fen_to_pos(&p, fen) != 0) {
+    return 1;
+  }
+  pack_position(&p, pp);
+  return 0;
+}
+
+// Translate a packed position into a fen string.  Returns 0 if pp is not a
+// valid position, and the length written (as pos_to_fen) otherwise.
+int packed_to_fen(const packed_position_t *pp, char *fen) {
+  position_t p;
+  if (unpack_position(pp, &p) != 0) {
+    return 0;
+  }
+  return pos_to_fen(&p, fen);
+}
@@ -4,6 +4,7 @@
 #define FEN_H
 
 struct position;
+struct packed_position;
 
 // Assuming BOARD_WIDTH is at most 99, MAX_FEN_CHARS is
 //   BOARD_WIDTH * BOARD_WIDTH * 2  (for a piece in every square)
@@ -13,5 +14,7 @@ struct position;
 
 int fen_to_pos(struct position *p, char *fen);
 int pos_to_fen(struct position *p, char *fen);
+int fen_to_packed(char *fen, struct packed_position *pp);
+int packed_to_fen(const struct packed_position *pp, char *fen);
 
 #endif  // FEN_H
@@ -22,12 +22,14 @@
 #include "./move_gen.h"
 #include "./search.h"
 #include "./tbassert.h"
+#include "./timeman.h"
 #include "./tt.h"
 #include "./util.h"
 
 char  VERSION[] = "1038";
 
 #define MAX_HASH 4096       // 4 GB
+#define MAX_THREADS 64      // Lazy SMP search threads
 #define INF_TIME 99999999999.0
 #define INF_DEPTH 999       // if user does not specify a depth, use 999
 
@@ -52,6 +54,7 @@ extern int USE_NMM;
 extern int FUT_DEPTH;
 extern int TRACE_MOVES;
 extern int DETECT_DRAWS;
+extern int MERGE_TABLES;
 
 // defined in eval.c
 extern int RANDOMIZE;
@@ -70,6 +73,28 @@ extern int USE_KO;
 extern int USE_TT;
 extern int HASH;
 
+// Lazy SMP: run THREADS independent serial searches sharing only the hash
+// table, instead of the Cilk search.
+static int LAZY_SMP;
+static int THREADS;
+
+// Search serially, in one thread, so that node counts are reproducible.
+static int DETERMINISTIC;
+
+// Aspiration windows: after the first iteration, search a window of
+// ASP_WINDOW either side of the last score, and widen the side that fails by
+// ASP_WIDEN percent each time, until the score lands inside.  An ASP_WINDOW
+// of 0 searches with a full window throughout.
+static int ASP_WINDOW;
+static int ASP_WIDEN;
+
+// Send the move to ponder on with the best move.
+static int PONDER;
+
+// Manage the time of a move by the branching factor and the stability of the
+// best move (see timeman.h), rather than stopping at RATIO_FOR_TIMEOUT.
+static int TIME_MANAGER;
+
 // struct for manipulating options below
 typedef struct {
   char      name[MAX_CHARS_IN_TOKEN];   // name of options
@@ -102,6 +127,14 @@ static int_options iopts[] = {
   { "lmr_r2",                   &LMR_R2,   20,                    1,              MAX_NUM_MOVES },
   { "hmb",                         &HMB,   0.03 * PAWN_VALUE,     0,              PAWN_VALUE    },
   { "fut_depth",             &FUT_DEPTH,   3,                     0,              5             },
+  { "lazy_smp",               &LAZY_SMP,   0,                     0,              1             },
+  { "threads",                 &THREADS,   1,                     1,              MAX_THREADS   },
+  { "merge_tables",       &MERGE_TABLES,   1,                     0,              1             },
+  { "deterministic",     &DETERMINISTIC,   0,                     0,              1             },
+  { "asp_window",           &ASP_WINDOW,   0.5 * PAWN_VALUE,      0,              10 * PAWN_VALUE },
+  { "asp_widen",             &ASP_WIDEN,   100,                   1,              1000          },
+  { "ponder",                   &PONDER,   0,                     0,              1             },
+  { "time_manager",       &TIME_MANAGER,   1,                     0,              1             },
   // debug options
   { "use_nmm",                 &USE_NMM,   1,                     0,              1             },
   { "detect_draws",       &DETECT_DRAWS,   1,                     0,              1             },
@@ -166,84 +199,539 @@ typedef enum {
 // -----------------------------------------------------------------------------
 
 static move_t bestMoveSoFar;
+static move_t ponderMoveSoFar;  // the reply expected to bestMoveSoFar
+static int depthSoFar;          // deepest iteration completed
+static timeManager time_manager;  // of the main search thread
 static char theMove[MAX_CHARS_IN_MOVE];
 
+// "go ponder" searches on the opponent's time, with no time limit, until
+// "ponderhit" says the opponent has played the move pondered on, which
+// starts the clock, or until "stop".  The best move is held back until then.
+static bool pondering = false;
+static double ponder_goal;  // time to take after ponderhit
+static pthread_mutex_t ponder_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t ponder_cond = PTHREAD_COND_INITIALIZER;
+
+static bool is_pondering() {
+  return __atomic_load_n(&pondering, __ATOMIC_ACQUIRE);
+}
+
+// Ends pondering: on a hit, the search goes on against the clock.
+static void end_ponder(bool hit) {
+  pthread_mutex_lock(&ponder_mutex);
+  if (pondering) {
+    if (hit) {
+      init_abort_timer(ponder_goal);
+    }
+    __atomic_store_n(&pondering, false, __ATOMIC_RELEASE);
+    pthread_cond_broadcast(&ponder_cond);
+  }
+  pthread_mutex_unlock(&ponder_mutex);
+}
+
 static pthread_mutex_t entry_mutex;
 static uint64_t node_count_serial;
 
+static searchContext contexts[MAX_THREADS];
+
+// One search thread.  Thread 0 is the main one: it prints the search info
+// and keeps bestMoveSoFar up to date.
 typedef struct {
   position_t *p;
   int depth;
   double tme;
+  int id;
+  uint64_t nodes;
+  int completed_depth;  // of the last iteration not aborted
+  score_t score;        // and its score
+  move_t pv[MAX_PLY_IN_SEARCH];  // and its principal variation
+  int fail_lows;        // aspiration windows failed low
+  int fail_highs;       // and high
 } entry_point_args;
 
+// Searches iteration d within aspiration windows around the score of the
+// last completed iteration, re-searching with the failing side widened
+// until the score lands inside the window.
+static score_t aspiration_search(entry_point_args *arg, int d, move_t *pv) {
+  searchContext *ctx = &contexts[arg->id];
+  FILE *out = arg->id == 0 ? OUT : NULL;
+  int delta = ASP_WINDOW;
+  int alpha = -INF;
+  int beta = INF;
+  if (ASP_WINDOW > 0 && arg->completed_depth > 0) {
+    alpha = arg->score - delta > -INF ? arg->score - delta : -INF;
+    beta = arg->score + delta < INF ? arg->score + delta : INF;
+  }
+
+  while (true) {
+    score_t score = searchRoot(ctx, arg->p, alpha, beta, d, 0, pv,
+                               &arg->nodes, out);
+    if (should_abort()) {
+      return score;
+    }
+
+    const int step = delta * ASP_WIDEN / 100;
+    delta += step > 0 ? step : 1;
+    if (score <= alpha && alpha > -INF) {
+      arg->fail_lows++;
+      alpha = score - delta > -INF ? score - delta : -INF;
+      if (out != NULL) {
+        fprintf(out, "info depth %d score cp %d upperbound\n", d, score);
+      }
+    } else if (score >= beta && beta < INF) {
+      arg->fail_highs++;
+      beta = score + delta < INF ? score + delta : INF;
+      if (out != NULL) {
+        fprintf(out, "info depth %d score cp %d lowerbound\n", d, score);
+      }
+    } else {
+      return score;
+    }
+  }
+}
+
 void *entry_point(void *arg) {
   move_t subpv[MAX_PLY_IN_SEARCH];
 
   entry_point_args *real_arg = (entry_point_args *) arg;
   int depth = real_arg->depth;
-  position_t *p = real_arg->p;
   double tme = real_arg->tme;
+  const int id = real_arg->id;
 
   double et = 0.0;
 
-  // start time of search
-  init_abort_timer(tme);
-
-  init_best_move_history();
-  tt_age_hashtable();
-
-  init_tics();
-
-  for (int d = 1; d <= depth; d++) {  // Iterative deepening
-    reset_abort();
-
-    searchRoot(p, -INF, INF, d, 0, subpv, &node_count_serial,
-                OUT);
+  // Odd helper threads start one ply deeper, so that the threads do not all
+  // search the same depth at the same time.
+  for (int d = 1 + id % 2; d <= depth; d++) {  // Iterative deepening
+    const uint64_t nodes_before = real_arg->nodes;
+    score_t score = aspiration_search(real_arg, d, subpv);
+    merge_search_tables(&contexts[id]);
 
     et = elapsed_time();
-    bestMoveSoFar = subpv[0];
-
     if (!should_abort()) {
-      // print something?
+      if (id == 0) {
+        bestMoveSoFar = subpv[0];
+        ponderMoveSoFar = subpv[0] != 0 ? subpv[1] : 0;
+      }
+      real_arg->completed_depth = d;
+      real_arg->score = score;
+      memcpy(real_arg->pv, subpv, sizeof(subpv));
     } else {
       break;
     }
 
     // don't start iteration that you cannot complete
-    if (et > tme * RATIO_FOR_TIMEOUT) break;
+    if (TIME_MANAGER) {
+      // The main thread decides for all of them.
+      if (id == 0) {
+        tm_iteration_done(&time_manager, real_arg->nodes - nodes_before,
+                          contexts[0].best_move_nodes, subpv[0], score);
+        if (tm_should_stop(&time_manager, et) && !is_pondering()) break;
+      }
+    } else if (et > tme * RATIO_FOR_TIMEOUT && !is_pondering()) {
+      break;
+    }
   }
 
-  // This unlock will allow the main thread lock/unlock in UCIBeginSearch to
-  // proceed
-  pthread_mutex_unlock(&entry_mutex);
+  // The main thread finishing, or any thread reaching the full depth, ends
+  // the search for all of them.
+  if (id == 0 || real_arg->completed_depth == depth) {
+    abort_search();
+  }
+
+  if (id == 0) {
+    // This unlock will allow the main thread lock/unlock in UCIBeginSearch to
+    // proceed
+    pthread_mutex_unlock(&entry_mutex);
+  }
 
   return NULL;
 }
 
+// The first legal move in p, played if the search is stopped before it
+// completes an iteration; 0 if there is none.
+static move_t first_legal_move(position_t *p) {
+  sortable_move_t lst[MAX_NUM_MOVES];
+  const int num_moves = generate_all(p, lst, true);
+  for (int i = 0; i < num_moves; i++) {
+    position_t np;
+    const move_t mv = get_move(lst[i]);
+    const victims_t victims = make_move(p, &np, mv);
+    if (!is_ILLEGAL(victims) && !is_KO(victims)) {
+      return mv;
+    }
+  }
+  return 0;
+}
+
 // Makes call to entry_point -> make call to searchRoot -> searchRoot in search.c
-void UciBeginSearch(position_t *p, int depth, double tme) {
+//
+// In Lazy SMP mode the helper threads run entry_point as well, and the
+// deepest iteration completed by any thread gives the best move.  The
+// caller has started the clock.
+static void run_search(position_t *p, int depth, double tme) {
   pthread_mutex_lock(&entry_mutex);  // setup for the barrier
-  entry_point_args args;
-  args.depth = depth;
-  args.p = p;
-  args.tme = tme;
-  node_count_serial = 0;
-  entry_point(&args);
+  const bool serial = LAZY_SMP || DETERMINISTIC;
+  const int num_threads = (LAZY_SMP && !DETERMINISTIC) ? THREADS : 1;
+  static entry_point_args args[MAX_THREADS];
+  pthread_t threads[MAX_THREADS];
+
+  tt_age_hashtable();
+  tm_start(&time_manager, tme);
+  bestMoveSoFar = first_legal_move(p);
+  ponderMoveSoFar = 0;
+
+  for (int i = 0; i < num_threads; i++) {
+    init_search_context(&contexts[i], p, serial);
+    args[i].depth = depth;
+    args[i].p = p;
+    args[i].tme = tme;
+    args[i].id = i;
+    args[i].nodes = 0;
+    args[i].completed_depth = 0;
+    args[i].fail_lows = 0;
+    args[i].fail_highs = 0;
+  }
+
+  // If a thread cannot be started, search with the ones that could.
+  int started = 1;
+  while (started < num_threads &&
+         pthread_create(&threads[started], NULL, entry_point,
+                        &args[started]) == 0) {
+    started++;
+  }
+  entry_point(&args[0]);
+
+  node_count_serial = args[0].nodes;
+  int fail_lows = args[0].fail_lows;
+  int fail_highs = args[0].fail_highs;
+  int deepest = 0;
+  for (int i = 1; i < started; i++) {
+    pthread_join(threads[i], NULL);
+    node_count_serial += args[i].nodes;
+    fail_lows += args[i].fail_lows;
+    fail_highs += args[i].fail_highs;
+    if (args[i].completed_depth > args[deepest].completed_depth) {
+      deepest = i;
+    }
+  }
+  depthSoFar = args[deepest].completed_depth;
+
+  if (ASP_WINDOW > 0) {
+    fprintf(OUT, "info aspiration fail_low %d fail_high %d\n", fail_lows,
+            fail_highs);
+  }
+  if (!serial) {
+    const searchContext *ctx = &contexts[0];
+    fprintf(OUT, "info splits %" PRIu64 " aborts %" PRIu64 " wasted_nodes %"
+            PRIu64 "\n", ctx->splits, ctx->aborts, ctx->wasted_nodes);
+  }
+
+  if (deepest != 0) {
+    char pvbuf[MAX_PLY_IN_SEARCH * MAX_CHARS_IN_MOVE];
+    getPV(args[deepest].pv, pvbuf, MAX_PLY_IN_SEARCH * MAX_CHARS_IN_MOVE);
+    fprintf(OUT, "info depth %d thread %d nodes %" PRIu64 "\n",
+            args[deepest].completed_depth, deepest, node_count_serial);
+    fprintf(OUT, "info score cp %d pv %s\n", args[deepest].score, pvbuf);
+    bestMoveSoFar = args[deepest].pv[0];
+    ponderMoveSoFar = args[deepest].pv[1];
+  }
+
+  // A search that ran out of depth while pondering waits for the ponder
+  // move to be played, or for "stop", to give its move.
+  pthread_mutex_lock(&ponder_mutex);
+  while (pondering) {
+    pthread_cond_wait(&ponder_cond, &ponder_mutex);
+  }
+  pthread_mutex_unlock(&ponder_mutex);
 
   char bms[MAX_CHARS_IN_MOVE];
   move_to_str(bestMoveSoFar, bms, MAX_CHARS_IN_MOVE);
   snprintf(theMove, MAX_CHARS_IN_MOVE, "%s", bms);
-  fprintf(OUT, "bestmove %s\n", bms);
+  if (PONDER && ponderMoveSoFar != 0) {
+    char pms[MAX_CHARS_IN_MOVE];
+    move_to_str(ponderMoveSoFar, pms, MAX_CHARS_IN_MOVE);
+    fprintf(OUT, "bestmove %s ponder %s\n", bms, pms);
+  } else {
+    fprintf(OUT, "bestmove %s\n", bms);
+  }
   return;
 }
 
+// Searches p to the given depth or for the given time, in this thread.
+void UciBeginSearch(position_t *p, int depth, double tme) {
+  // start time of search
+  init_abort_timer(tme);
+  reset_abort();
+  run_search(p, depth, tme);
+}
+
+// -----------------------------------------------------------------------------
+// Background search
+//
+// "go" runs the search on a thread of its own, so that the main thread can
+// keep reading commands.  "stop", "ponderhit" and "isready" are handled at
+// once; any other command waits for the search to finish first.
+// -----------------------------------------------------------------------------
+
+typedef struct {
+  position_t *p;
+  int depth;
+  double tme;
+} search_thread_args;
+
+static pthread_t search_thread;
+static bool searching = false;  // search_thread is yet to be joined
+
+static void *search_thread_main(void *arg) {
+  search_thread_args *real_arg = (search_thread_args *) arg;
+  run_search(real_arg->p, real_arg->depth, real_arg->tme);
+  return NULL;
+}
+
+// Starts searching p in the background, pondering if ponder is set.  The
+// clock is started (or, when pondering, held) here rather than in the
+// search thread, so that a "stop" sent right away is not lost.
+static void start_search(position_t *p, int depth, double tme, bool ponder) {
+  static search_thread_args args;
+  args.p = p;
+  args.depth = depth;
+  args.tme = tme;
+
+  ponder_goal = tme;
+  __atomic_store_n(&pondering, ponder, __ATOMIC_RELEASE);
+  init_abort_timer(ponder ? INF_TIME : tme);
+  reset_abort();
+
+  if (pthread_create(&search_thread, NULL, search_thread_main, &args) != 0) {
+    // Search in this thread, where nothing could end the pondering.
+    __atomic_store_n(&pondering, false, __ATOMIC_RELEASE);
+    init_abort_timer(tme);
+    run_search(p, depth, tme);
+    return;
+  }
+  searching = true;
+}
+
+// Waits for the background search, if any, to finish.
+static void finish_search() {
+  if (searching) {
+    pthread_join(search_thread, NULL);
+    searching = false;
+  }
+}
+
+// Stops the background search, if any; it still sends its best move.
+static void stop_search() {
+  if (searching) {
+    abort_search();
+    end_ponder(false);
+    finish_search();
+  }
+}
+
+// Says how big the hash table is and what memory it is on.
+static void print_hash_info() {
+  printf("info string Hash table set to %d records of "
+         "%zu bytes each\n",
+         tt_get_num_of_records(), tt_get_bytes_per_record());
+  printf("info string Total hash table size: %zu bytes on %s\n",
+         tt_get_num_of_records() * tt_get_bytes_per_record(),
+         tt_get_backing());
+}
+
+// Runs the hash table file command cmd ("hashsave", "hashload" or
+// "hashfile") on file.
+static void hash_file_command(const char *cmd, const char *file) {
+  const char *error;
+  if (strcmp(cmd, "hashsave") == 0) {
+    error = tt_save_hashtable(file);
+  } else if (strcmp(cmd, "hashload") == 0) {
+    error = tt_load_hashtable(file);
+  } else {
+    error = tt_map_hashtable_file(file);
+  }
+  if (error != NULL) {
+    fprintf(OUT, "info string %s %s failed: %s\n", cmd, file, error);
+    return;
+  }
+  if (strcmp(cmd, "hashsave") == 0) {
+    fprintf(OUT, "info string Hash table saved to %s\n", file);
+  } else {
+    fprintf(OUT, "info setting hash to %d\n", HASH);
+    print_hash_info();
+  }
+}
+
+// -----------------------------------------------------------------------------
+// Benchmark
+// -----------------------------------------------------------------------------
+
+// The positions searched by "bench": the start position and the ends of a
+// few lines from tests/book.dta, as moves from the start position.
+static const char *bench_lines[] = {
+  "",
+  "i3R b3R j4R b6R i6j7 b3a2 f0f1 a2b1 d1U a5b5",
+  "i3R b3R j4R a5b4 j4i5 b6R j0i0 a9b9 i3i2 c7L",
+  "j4R b3R i3R a5b4 i3j2 b4c4 j2j1 a9b8 i6R b6b7",
+  "i3R b3R j4R b6R i6i7 a5b5 i3j2 c7L h2L b6a7",
+  NULL
+};
+
+#define BENCH_MAX_MOVES 16
+
+// Searches each bench position to the given depth from a cleared hash table
+// and reports the total nodes, time and nodes per second, for comparing
+// builds and search modes.  The total time is the time to depth.  The
+// current game position is left alone.
+void bench(int depth) {
+  static position_t line[BENCH_MAX_MOVES + 1];
+  uint64_t nodes = 0;
+  double time = 0.0;
+  int hashfull = 0;
+  if (tt_on_file()) {  // bench clears the table, which would clear the file
+    fprintf(OUT, "info string bench refused: the hash table is on a file\n");
+    return;
+  }
+#if TT_STATS
+  tt_reset_stats();
+#endif
+
+  for (int i = 0; bench_lines[i] != NULL; i++) {
+    char moves[MAX_CHARS_IN_MOVE * BENCH_MAX_MOVES];
+    snprintf(moves, sizeof(moves), "%s", bench_lines[i]);
+
+    int ix = 0;
+    fen_to_pos(&line[0], "");
+    for (char *mv = strtok(moves, " "); mv != NULL; mv = strtok(NULL, " ")) {
+      tbassert(ix < BENCH_MAX_MOVES, "bench line too long\n");
+      if (is_ILLEGAL(make_from_string(&line[ix], &line[ix + 1], mv))) {
+        fprintf(OUT, "info string bad bench move %s\n", mv);
+        return;
+      }
+      ix++;
+    }
+
+    tt_resize_hashtable(HASH);  // clears the table
+    const double start = milliseconds();
+    UciBeginSearch(&line[ix], depth, INF_TIME);
+    time += milliseconds() - start;
+    nodes += node_count_serial;
+    hashfull += tt_hashfull();
+  }
+
+  char mode[MAX_CHARS_IN_TOKEN];
+  if (DETERMINISTIC) {
+    snprintf(mode, sizeof(mode), "deterministic");
+  } else if (LAZY_SMP) {
+    snprintf(mode, sizeof(mode), "lazy_smp threads %d", THREADS);
+  } else {
+    snprintf(mode, sizeof(mode), "cilk");
+  }
+  fprintf(OUT, "bench depth %d mode %s nodes %"PRIu64" time %d ms nps %"PRIu64
+          "\n", depth, mode, nodes, (int) time,
+          time > 0 ? (uint64_t) (1000 * nodes / time) : 0);
+
+#if TT_STATS
+  uint64_t probes, hits, torn;
+  tt_get_stats(&probes, &hits, &torn);
+  fprintf(OUT, "info hash probes %" PRIu64 " hits %" PRIu64 " hit_rate %.1f "
+          "hashfull %d torn %" PRIu64 "\n", probes, hits,
+          probes > 0 ? 100.0 * hits / probes : 0,
+          hashfull / (int) (sizeof(bench_lines) / sizeof(bench_lines[0]) - 1),
+          torn);
+#endif
+}
+
+#define TIMETEST_MAX_MOVES 512
+
+// Replays the games in file, one a line as moves from the start position
+// (tests/book.dta, say), searching every position on a simulated clock of
+// tme milliseconds a side with inc milliseconds an increment, as the go
+// command would.  Reports the time taken a move against the goal, the
+// moves over the goal and over 3 times it (the hard limit), the games lost
+// on time and the average depth.  For tuning the time manager; compare with
+// "setoption name time_manager value 0".  The game position is left alone.
+void timetest(const char *file, double tme, double inc, int max_games) {
+  static position_t line[TIMETEST_MAX_MOVES + 1];
+  char buf[MAX_CHARS_IN_MOVE * TIMETEST_MAX_MOVES];
+
+  FILE *games = fopen(file, "r");
+  if (games == NULL) {
+    fprintf(OUT, "info string cannot open %s\n", file);
+    return;
+  }
+
+  int num_games = 0, moves = 0, over_goal = 0, over_hard = 0, flagged = 0;
+  int depths = 0;
+  double used = 0.0, goals = 0.0, worst = 0.0;
+
+  // The searches print nothing.
+  FILE *out = OUT;
+  FILE *null = fopen("/dev/null", "w");
+  if (null == NULL) {
+    fclose(games);
+    return;
+  }
+
+  while (num_games < max_games && fgets(buf, sizeof(buf), games) != NULL) {
+    double clock[2] = {tme, tme};
+    bool lost = false;
+    int ix = 0;
+    fen_to_pos(&line[0], "");
+    for (char *mv = strtok(buf, " \r\n"); mv != NULL && ix < TIMETEST_MAX_MOVES;
+         mv = strtok(NULL, " \r\n")) {
+      const color_t c = color_to_move_of(&line[ix]);
+      const double goal = tm_goal(clock[c], inc);
+      OUT = null;
+      const double start = milliseconds();
+      UciBeginSearch(&line[ix], INF_DEPTH, goal);
+      const double ms = milliseconds() - start;
+      OUT = out;
+
+      moves++;
+      used += ms;
+      goals += goal;
+      depths += depthSoFar;
+      if (ms > goal) over_goal++;
+      if (ms > 3 * goal) over_hard++;
+      if (ms / goal > worst) worst = ms / goal;
+      clock[c] -= ms;
+      if (clock[c] < 0 && !lost) {
+        lost = true;
+        flagged++;
+      }
+      clock[c] += inc;
+
+      if (is_ILLEGAL(make_from_string(&line[ix], &line[ix + 1], mv))) {
+        fprintf(OUT, "info string bad move %s in game %d\n", mv,
+                num_games + 1);
+        break;
+      }
+      ix++;
+    }
+    num_games++;
+  }
+  fclose(null);
+  fclose(games);
+
+  fprintf(OUT, "timetest games %d moves %d time %d ms goal %d ms "
+          "over_goal %d over_hard %d worst %.2f flagged %d depth %.2f\n",
+          num_games, moves, (int) used, (int) goals, over_goal, over_hard,
+          worst, flagged, moves > 0 ? (double) depths / moves : 0.0);
+}
+
 // -----------------------------------------------------------------------------
 // argparse help
 // -----------------------------------------------------------------------------
 
 // print help messages in uci
 void help()  {
+  printf("bench     - Search a fixed set of positions and report the total nodes,\n");
+  printf("            time and nodes per second.  Used to compare builds and\n");
+  printf("            search modes (see the lazy_smp and threads options).\n");
+  printf("            Sample usage: \n");
+  printf("                bench 6: search each position to depth 6 (default 5)\n");
   printf("eval      - Evaluate current position.\n");
   printf("display   - Display current board state.\n");
   printf("generate  - Generate all possible moves.\n");
@@ -252,9 +740,20 @@ void help()  {
   printf("            time <time_limit>: search assume you have <time> amount of time\n");
   printf("                               for the whole game.\n");
   printf("            inc <time_inc>:    set the fischer time increment for the search\n");
+  printf("            ponder:            search on the opponent's time until ponderhit\n");
+  printf("                               or stop\n");
   printf("            Both time arguments are specified in milliseconds.\n");
+  printf("            The search runs in the background; see stop and ponderhit.\n");
   printf("            Sample usage: \n");
   printf("                go depth 4: search until depth 4\n");
+  printf("hashfile  - Map the hash table on a file, so that it persists from run to run.\n");
+  printf("            A new file gets an empty table of the size of the hash option.\n");
+  printf("            Sample usage: \n");
+  printf("                hashfile analysis.tt\n");
+  printf("hashload  - Load the hash table from a file written by hashsave.\n");
+  printf("hashsave  - Save the hash table to a file.\n");
+  printf("            Sample usage: \n");
+  printf("                hashsave opening.tt\n");
   printf("help      - Display help (this info).\n");
   printf("isready   - Ask if the UCI engine is ready, if so it echoes \"readyok\".\n");
   printf("            This is mainly used to synchronize the engine with the GUI.\n");
@@ -265,6 +764,10 @@ void help()  {
   printf("            Used to verify move the generator.\n");
   printf("            Sample usage: \n");
   printf("                depth 3: generate all possible moves for depth 1--3\n");
+  printf("                perft 3 check: also verify keys, packing and bitboards\n");
+  printf("                perft 5 divide: also print the count below each root move\n");
+  printf("                perft 6 hash 256: count with the help of a 256 MB hash table\n");
+  printf("ponderhit - The move pondered on was played: search on against the clock.\n");
   printf("position  - Set up the board using the fenstring given.  Possible arguments are:\n");
   printf("            startpos:     set up the board with default starting position.\n");
   printf("            endgame:      set up the board with endgame configuration.\n");
@@ -278,6 +781,15 @@ void help()  {
   printf("            Use the comment \"uci\" to see possible options and their current values\n");
   printf("            Sample usage: \n");
   printf("                setoption name fut_depth value 4: set fut_depth to 4\n");
+  printf("stop      - Stop searching and send the best move found so far.\n");
+  printf("timetest  - Replay recorded games on a simulated clock and report the time\n");
+  printf("            taken against the time manager's goals.  Possible arguments are:\n");
+  printf("            <file>:       games, one a line of moves from the start position\n");
+  printf("            time <time>:  time a side, in milliseconds (default 30000)\n");
+  printf("            inc <inc>:    increment, in milliseconds (default 100)\n");
+  printf("            games <n>:    replay the first n games (default 10)\n");
+  printf("            Sample usage: \n");
+  printf("                timetest ../tests/book.dta time 10000 games 2\n");
   printf("uci       - Display UCI version and options\n");
   printf("\n");
 }
@@ -409,6 +921,7 @@ int main(int argc, char *argv[]) {
 
   init_options();
   init_zob();
+  init_bitboards();
 
   char **tok = (char **) malloc(sizeof(char *) * MAX_CHARS_IN_TOKEN * MAX_PLY_IN_GAME);
   int   ix = 0;  // index of which position we are operating on
@@ -441,10 +954,26 @@ int main(int argc, char *argv[]) {
         saw_input = true;
       }
 
+      if (strcmp(tok[0], "stop") == 0) {
+        stop_search();
+        continue;
+      }
+
+      if (strcmp(tok[0], "ponderhit") == 0) {
+        end_ponder(true);
+        continue;
+      }
+
       if (strcmp(tok[0], "quit") == 0) {
+        stop_search();  // it still sends its move
         break;
       }
 
+      // Anything else but "isready" waits for the search to finish.
+      if (strcmp(tok[0], "isready") != 0) {
+        finish_search();
+      }
+
       if (strcmp(tok[0], "position") == 0) {
         n = 0;
         if (token_count < 2) {  // no input
@@ -458,10 +987,7 @@ int main(int argc, char *argv[]) {
           n = 2;
         } else if (strcmp(tok[1], "endgame") == 0) {
           ix = 0;
-          if (BOARD_WIDTH == 10)
-            fen_to_pos(&gme[ix], "ss9/10/10/10/10/10/10/10/10/9NN W");
-          else if (BOARD_WIDTH == 8)
-            fen_to_pos(&gme[ix], "ss7/8/8/8/8/8/8/7NN W");
+          fen_to_pos(&gme[ix], ENDGAME_FEN);
           n = 2;
         } else if (strcmp(tok[1], "fen") == 0) {
           if (token_count < 3) {  // no input
@@ -572,6 +1098,11 @@ int main(int argc, char *argv[]) {
             lower_case(loc);
             if (strcmp(name+1, loc) == 0) {
               recognized = true;
+              if (strcmp(name+1, "hash") == 0 && tt_on_file()) {
+                printf("info string Hash table is on a file and stays at %d "
+                       "MB\n", HASH);
+                break;
+              }
               int v = strtol(value + 1, (char **)NULL, 10);
               if (v < iopts[j].min) {
                 v = iopts[j].min;
@@ -584,11 +1115,7 @@ int main(int argc, char *argv[]) {
 
               if (strcmp(name+1, "hash") == 0) {
                 tt_resize_hashtable(HASH);
-                printf("info string Hash table set to %d records of "
-                       "%zu bytes each\n",
-                       tt_get_num_of_records(), tt_get_bytes_per_record());
-                printf("info string Total hash table size: %zu bytes\n",
-                       tt_get_num_of_records() * tt_get_bytes_per_record());
+                print_hash_info();
               }
               break;
             }
@@ -610,6 +1137,16 @@ int main(int argc, char *argv[]) {
         continue;
       }
 
+      if (strcmp(tok[0], "hashsave") == 0 || strcmp(tok[0], "hashload") == 0 ||
+          strcmp(tok[0], "hashfile") == 0) {
+        if (token_count < 2) {
+          fprintf(OUT, "Second argument required.  Use 'help' to see valid commands.\n");
+          continue;
+        }
+        hash_file_command(tok[0], tok[1]);
+        continue;
+      }
+
       sortable_move_t  lst[MAX_NUM_MOVES];
       if (strcmp(tok[0], "generate") == 0) {
         int num_moves = generate_all(&gme[ix], lst, true);
@@ -644,6 +1181,7 @@ int main(int argc, char *argv[]) {
         double inc = 0.0;
         int    depth = INF_DEPTH;
         double goal = INF_TIME;
+        bool   ponder = false;
 
         // process various tokens here
         for (int n = 1; n < token_count; n++) {
@@ -662,21 +1200,52 @@ int main(int argc, char *argv[]) {
             inc = strtod(tok[n], (char **)NULL);
             continue;
           }
+          if (strcmp(tok[n], "ponder") == 0) {
+            ponder = true;
+            continue;
+          }
         }
 
         if (depth < INF_DEPTH) {
-          UciBeginSearch(&gme[ix], depth, INF_TIME);
+          start_search(&gme[ix], depth, INF_TIME, ponder);
         } else {
           //          use_precomp = inc > 1750; // inc value when running blitz mode is 500 and inc value when running regular mode is 2000. We want regular mode to use precomputation values
-          goal = tme * 0.02;   // use about 1/50 of main time
-          goal += inc * 0.80;  // use most of increment
-          // sanity check,  make sure that we don't run ourselves too low
-          if (goal*10 > tme) goal = tme / 10.0;
-          UciBeginSearch(&gme[ix], INF_DEPTH, goal);
+          goal = tm_goal(tme, inc);
+          start_search(&gme[ix], INF_DEPTH, goal, ponder);
         }
         continue;
       }
 
+      if (strcmp(tok[0], "bench") == 0) {
+        int depth = 5;
+        if (token_count >= 2) {
+          depth = strtol(tok[1], (char **)NULL, 10);
+        }
+        bench(depth);
+        continue;
+      }
+
+      if (strcmp(tok[0], "timetest") == 0) {
+        if (token_count < 2) {
+          fprintf(OUT, "Second argument required.  Use 'help' to see valid commands.\n");
+          continue;
+        }
+        double tme = 30000.0;
+        double inc = 100.0;
+        int games = 10;
+        for (int n = 2; n + 1 < token_count; n += 2) {
+          if (strcmp(tok[n], "time") == 0) {
+            tme = strtod(tok[n + 1], (char **)NULL);
+          } else if (strcmp(tok[n], "inc") == 0) {
+            inc = strtod(tok[n + 1], (char **)NULL);
+          } else if (strcmp(tok[n], "games") == 0) {
+            games = strtol(tok[n + 1], (char **)NULL, 10);
+          }
+        }
+        timetest(tok[1], tme, inc, games);
+        continue;
+      }
+
       if (strcmp(tok[0], "perft") == 0) {  // Test move generator
         // Correct output to depth 4
         // perft  1 62
@@ -688,7 +1257,23 @@ int main(int argc, char *argv[]) {
         if (token_count >= 2) {  // Takes a depth argument to test deeper
           depth = strtol(tok[1], (char **)NULL, 10);
         }
-        do_perft(gme, depth, 0);
+        // Options after the depth, in any order:
+        //   check      cross-check keys, packing, bitboards and move generators
+        //   divide     print the count below each root move
+        //   hash <mb>  back the count with a perft hash of <mb> megabytes
+        bool verify = false;
+        bool divide = false;
+        int hash_mb = 0;
+        for (int j = 2; j < token_count; j++) {
+          if (strcmp(tok[j], "check") == 0) {
+            verify = true;
+          } else if (strcmp(tok[j], "divide") == 0) {
+            divide = true;
+          } else if (strcmp(tok[j], "hash") == 0 && j + 1 < token_count) {
+            hash_mb = strtol(tok[++j], (char **)NULL, 10);
+          }
+        }
+        do_perft(gme, depth, 0, verify, divide, hash_mb);
         continue;
       }
 
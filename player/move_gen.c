@@ -5,6 +5,13 @@
 #include <stdint.h>
 #include <stdlib.h>
 #include <stdio.h>
+#include <string.h>
+
+#ifdef __cilk
+#include <cilk/cilk.h>
+#else
+#define cilk_for for  // without Cilk, perft counts serially
+#endif
 
 #define __STDC_FORMAT_MACROS
 #include <inttypes.h>
@@ -13,7 +20,7 @@
 #include "./fen.h"
 #include "./search.h"
 #include "./util.h"
-//#include "./precomp_tables.h"
+#include "./precomp_tables.h"
 
 #define MAX(x, y)  ((x) > (y) ? (x) : (y))
 #define MIN(x, y)  ((x) < (y) ? (x) : (y))
@@ -27,59 +34,6 @@ char *color_to_str(const color_t c) {
 }
 int old_generate_all(position_t *p, sortable_move_t *sortable_move_list,
                      bool strict);
-// -----------------------------------------------------------------------------
-// Piece getters and setters. Color, then type, then orientation.
-// -----------------------------------------------------------------------------
-
-// which color is moving next
-color_t color_to_move_of(const position_t *p) {
-  /*if ((p->ply & 1) == 0) {
-    return WHITE;
-  } else {
-    return BLACK;
-    }*/
-  return (p->ply & 1) == 0 ? WHITE : BLACK;
-}
-
-inline color_t color_of(const piece_t x) {
-  return (color_t) ((x >> COLOR_SHIFT) & COLOR_MASK);
-}
-
-color_t opp_color(const color_t c) {
-  /*if (c == WHITE) {
-    return BLACK;
-  } else {
-    return WHITE;
-    }*/
-  return (c == WHITE) ? BLACK : WHITE;
-}
-
-
-void set_color(piece_t *x, const color_t c) {
-  tbassert((c >= 0) & (c <= COLOR_MASK), "color: %d\n", c);
-  *x = ((c & COLOR_MASK) << COLOR_SHIFT) |
-      (*x & ~(COLOR_MASK << COLOR_SHIFT));
-}
-
-
-inline ptype_t ptype_of(const piece_t x) {
-  return (ptype_t) ((x >> PTYPE_SHIFT) & PTYPE_MASK);
-}
-
-void set_ptype(piece_t *x, ptype_t pt) {
-  *x = ((pt & PTYPE_MASK) << PTYPE_SHIFT) |
-      (*x & ~(PTYPE_MASK << PTYPE_SHIFT));
-}
-
-inline int8_t ori_of(const piece_t x) {
-  return (x >> ORI_SHIFT) & ORI_MASK;
-}
-
-void set_ori(piece_t *x, const int ori) {
-  *x = ((ori & ORI_MASK) << ORI_SHIFT) |
-      (*x & ~(ORI_MASK << ORI_SHIFT));
-}
-
 // King orientations
 const char *king_ori_to_rep[2][NUM_ORI] = { { "NN", "EE", "SS", "WW" },
                                       { "nn", "ee", "ss", "ww" } };
@@ -99,76 +53,113 @@ static uint64_t   zob_color;
 uint64_t myrand();
 
 // Zobrist hashing
-inline uint64_t compute_zob_key(position_t *p) {
+//
+// Empty squares hash to 0, so a key is just the xor over the pieces on the
+// board.  The Kings and pawns are found through kloc and plocs, which makes
+// recomputing a key about 16 lookups instead of 100 and keeps the tbassert
+// checks in DEBUG builds cheap.  (A zapped King is already gone from the
+// board, so the lookup at its stale kloc yields 0.)
+
+uint64_t compute_pawn_key(const position_t *p) {
   uint64_t key = 0;
-  for (fil_t f = 0; f < BOARD_WIDTH; f++) {
-    for (rnk_t r = 0; r < BOARD_WIDTH; r++) {
-      square_t sq = square_of(f, r);
-      key ^= zob[sq][p->board[sq]];
+  for (color_t c = WHITE; c <= BLACK; c++) {
+    for (int i = 0; i < NUMBER_PAWNS; i++) {
+      const square_t sq = p->plocs[c][i];
+      if (sq != 0) {
+        key ^= zob[sq][p->board[sq]];
+      }
     }
   }
+  return key;
+}
+
+uint64_t compute_king_key(const position_t *p) {
+  return zob[p->kloc[WHITE]][p->board[p->kloc[WHITE]]] ^
+      zob[p->kloc[BLACK]][p->board[p->kloc[BLACK]]];
+}
+
+uint64_t compute_zob_key(const position_t *p) {
+  uint64_t key = compute_pawn_key(p) ^ compute_king_key(p);
   if (color_to_move_of(p) == BLACK)
     key ^= zob_color;
 
   return key;
 }
 
-void init_zob() {
-  for (int i = 0; i < ARR_SIZE; i++) {
-    for (int j = 0; j < (1 << PIECE_SIZE); j++) {
-      zob[i][j] = myrand();
-    }
-  }
-  zob_color = myrand();
+// Sets the full hash key and the pawn and King subkeys of a freshly built
+// position.
+void compute_keys(position_t *p) {
+  p->pawn_key = compute_pawn_key(p);
+  p->king_key = compute_king_key(p);
+  p->key = compute_zob_key(p);
 }
 
-// For no square, use 0, which is guaranteed to be off board
-square_t square_of(fil_t f, rnk_t r) {
-  square_t s = ARR_WIDTH * (FIL_ORIGIN + f) + RNK_ORIGIN + r;
-  DEBUG_LOG(1, "Square of (file %d, rank %d) is %d\n", f, r, s);
-  tbassert((s >= 0) && (s < ARR_SIZE), "s: %d\n", s);
-  return s;
-}
+// The key p will have once mv has moved its piece (and stomped, if it
+// does), before the laser fires: the key of the child, unless the laser zaps
+// a piece.  Cheap enough to give the hash table a head start (tt_prefetch)
+// while do_move() fires the laser.
+uint64_t moved_key(const position_t *p, const move_t mv) {
+  const square_t from_sq = from_square(mv);
+  const square_t to_sq = to_square(mv);
+  piece_t from_piece = p->board[from_sq];
+  const piece_t to_piece = p->board[to_sq];
+  uint64_t key = p->key ^ zob_color ^ zob[from_sq][from_piece];
 
-// Finds file of square
-fil_t fil_of(square_t sq) {
-  fil_t f = ((sq >> FIL_SHIFT) & FIL_MASK) - FIL_ORIGIN;
-  DEBUG_LOG(1, "File of square %d is %d\n", sq, f);
-  return f;
+  if (to_sq != from_sq) {  // move, not rotation
+    key ^= zob[to_sq][to_piece] ^ zob[to_sq][from_piece];
+    // A stomped pawn lands on from_sq only to be removed.
+    if (!(PAWN == ptype_of(from_piece) && PAWN == ptype_of(to_piece) &&
+          color_of(to_piece) == opp_color(color_of(from_piece)))) {
+      key ^= zob[from_sq][to_piece];
+    }
+  } else {  // rotation
+    set_ori(&from_piece, rot_of(mv) + ori_of(from_piece));
+    key ^= zob[from_sq][from_piece];
+  }
+  return key;
 }
 
-// Finds rank of square
-rnk_t rnk_of(square_t sq) {
-  rnk_t r = ((sq >> RNK_SHIFT) & RNK_MASK) - RNK_ORIGIN;
-  DEBUG_LOG(1, "Rank of square %d is %d\n", sq, r);
-  return r;
+static inline bool keys_ok(const position_t *p) {
+  return p->key == compute_zob_key(p) &&
+      p->pawn_key == compute_pawn_key(p) &&
+      p->king_key == compute_king_key(p);
 }
 
-/*
-// For no square, use 0, which is guaranteed to be off board
-inline square_t square_of(const fil_t f, const rnk_t r) {
-//  square_t s = ARR_WIDTH * (FIL_ORIGIN + f) + RNK_ORIGIN + r;
-  square_t s = (square_t)square_of_table[f+3][r+3]; // the fil and rnk range from [-3,10] and [-3, 13] respectively so the +3 accounts for this
-  DEBUG_LOG(1, "Square of (file %d, rank %d) is %d\n", f, r, s);
-  tbassert((s >= 0) && (s < ARR_SIZE), "s: %d\n", s);
-  return s;
+// Toggles piece x on sq in the full key and in its subkey.
+static inline void toggle_key(position_t *p, const square_t sq,
+                              const piece_t x) {
+  const uint64_t z = zob[sq][x];
+  p->key ^= z;
+  if (ptype_of(x) == PAWN) {
+    p->pawn_key ^= z;
+  } else if (ptype_of(x) == KING) {
+    p->king_key ^= z;
+  }
 }
 
-// Finds file of square
-inline fil_t fil_of(const square_t sq) {
-//  fil_t f = ((sq >> FIL_SHIFT) & FIL_MASK) - FIL_ORIGIN;
-  fil_t f = (fil_t)(fil_of_table[sq]);
-  DEBUG_LOG(1, "File of square %d is %d\n", sq, f);
-  return f;
+void init_zob() {
+  for (int i = 0; i < ARR_SIZE; i++) {
+    for (int j = 0; j < (1 << PIECE_SIZE); j++) {
+      zob[i][j] = myrand();
+      if (ptype_of(j) == EMPTY) {
+        zob[i][j] = 0;  // still draw, to keep the myrand() sequence
+      }
+    }
+  }
+  zob_color = myrand();
 }
-// Finds rank of square
-inline rnk_t rnk_of(const square_t sq) {
-//  rnk_t r = ((sq >> RNK_SHIFT) & RNK_MASK) - RNK_ORIGIN;
-  rnk_t r = (fil_t)rnk_of_table[sq];
-  DEBUG_LOG(1, "Rank of square %d is %d\n", sq, r);
-  return r;
+
+// A fingerprint of the Zobrist keys.  Hash tables saved to files carry it,
+// so that they are only loaded by engines that key positions the same way.
+uint64_t zob_signature() {
+  uint64_t sig = zob_color;
+  for (int i = 0; i < ARR_SIZE; i++) {
+    for (int j = 0; j < (1 << PIECE_SIZE); j++) {
+      sig = ((sig << 7) | (sig >> 57)) ^ zob[i][j];
+    }
+  }
+  return sig;
 }
-*/
 
 // converts a square to string notation, returns number of characters printed
 inline int square_to_str(const square_t sq, char *buf, const size_t bufsize) {
@@ -181,67 +172,138 @@ inline int square_to_str(const square_t sq, char *buf, const size_t bufsize) {
   }
 }
 
-// direction map
-static const int8_t dir[8] = { -ARR_WIDTH - 1, -ARR_WIDTH, -ARR_WIDTH + 1, -1, 1,
-                      ARR_WIDTH - 1, ARR_WIDTH, ARR_WIDTH + 1 };
-inline int8_t dir_of(const int i) {
-  tbassert(i >= 0 && i < 8, "i: %d\n", i);
-  return dir[i];
-}
+// -----------------------------------------------------------------------------
+// Bitboards
+// -----------------------------------------------------------------------------
 
+bitboard_t bb_square[ARR_SIZE];
 
-// directions for laser: NN, EE, SS, WW
-static const int8_t beam[NUM_ORI] = {1, ARR_WIDTH, -1, -ARR_WIDTH};
+#if USE_BITBOARDS
+// bb_ray[dir][bit]: every square a beam leaving bit in direction dir crosses
+// before it runs off the board.
+static bitboard_t bb_ray[NUM_ORI][BB_SQUARES];
+#endif
 
-inline int8_t beam_of(const int direction) {
-  tbassert(direction >= 0 && direction < NUM_ORI, "dir: %d\n", direction);
-  return beam[direction];
+void init_bitboards() {
+  for (int b = 0; b < BB_SQUARES; b++) {
+    bb_square[square_of_bit(b)] = BB_ONE << b;
+  }
+#if USE_BITBOARDS
+  for (int b = 0; b < BB_SQUARES; b++) {
+    for (int d = 0; d < NUM_ORI; d++) {
+      bitboard_t ray = 0;
+      // fil_t and rnk_t are unsigned, so stepping off either edge of the
+      // board also leaves the range [0, BOARD_WIDTH).
+      for (square_t sq = square_of_bit(b) + beam_of(d);
+           fil_of(sq) < BOARD_WIDTH && rnk_of(sq) < BOARD_WIDTH;
+           sq += beam_of(d)) {
+        ray |= bb_of(sq);
+      }
+      bb_ray[d][b] = ray;
+    }
+  }
+#endif
 }
 
-// reflect[beam_dir][pawn_orientation]
-// -1 indicates back of Pawn
-const int8_t reflect[NUM_ORI][NUM_ORI] = {
-  //  NW  NE  SE  SW
-  { -1, -1, EE, WW},   // NN
-  { NN, -1, -1, SS},   // EE
-  { WW, EE, -1, -1 },  // SS
-  { -1, NN, SS, -1 }   // WW
-};
-
-inline int8_t reflect_of(const int beam_dir, const int pawn_ori) {
-  tbassert(beam_dir >= 0 && beam_dir < NUM_ORI, "beam-dir: %d\n", beam_dir);
-  tbassert(pawn_ori >= 0 && pawn_ori < NUM_ORI, "pawn-ori: %d\n", pawn_ori);
-  return reflect[beam_dir][pawn_ori];
-}
+#if USE_BITBOARDS
+// Follows the laser of c's King across the bitboards, jumping from one piece
+// to the next instead of stepping square by square.  Returns the square of
+// the piece the laser destroys, or 0 if it runs off the board.  If path is
+// not NULL, it receives every square the beam covers, King included, and
+// *crossed whether the beam covers any of them more than once.
+static square_t trace_laser(position_t *p, const color_t c, bitboard_t *path,
+                            bool *crossed) {
+  const bitboard_t occ = p->occ[WHITE] | p->occ[BLACK];
+  square_t sq = p->kloc[c];
+  int b = bit_of(sq);
+  int8_t bdir = ori_of(p->board[sq]);
+  bitboard_t covered = BB_ONE << b;
+  bool twice = false;
 
-// -----------------------------------------------------------------------------
-// Move getters and setters.
-// -----------------------------------------------------------------------------
+  tbassert(ptype_of(p->board[sq]) == KING,
+           "ptype: %d\n", ptype_of(p->board[sq]));
 
-inline ptype_t ptype_mv_of(const move_t mv) {
-  return (ptype_t) ((mv >> PTYPE_MV_SHIFT) & PTYPE_MV_MASK);
-}
+  while (true) {
+    const bitboard_t ray = bb_ray[bdir][b];
+    const bitboard_t blockers = occ & ray;
+    if (!blockers) {  // Ran off edge of board
+      twice |= (covered & ray) != 0;
+      covered |= ray;
+      sq = 0;
+      break;
+    }
+    // NN and EE beams walk toward higher bits, SS and WW toward lower ones.
+    // The beam covers its ray up to the blocker, that is all but the ray
+    // going on past the blocker.
+    b = (bdir == NN || bdir == EE) ? bb_lsb(blockers) : bb_msb(blockers);
+    const bitboard_t segment = ray & ~bb_ray[bdir][b];
+    twice |= (covered & segment) != 0;
+    covered |= segment;
+    sq = square_of_bit(b);
+    const piece_t x = p->board[sq];
+    if (ptype_of(x) == KING) {
+      break;  // sorry, game over my friend!
+    }
+    bdir = reflect_of(bdir, ori_of(x));
+    if (bdir < 0) {  // Hit back of Pawn
+      break;
+    }
+  }
 
-inline square_t from_square(const move_t mv) {
-  return (mv >> FROM_SHIFT) & FROM_MASK;
+  if (path != NULL) {
+    *path = covered;
+    *crossed = twice;
+  }
+  return sq;
 }
 
-inline square_t to_square(const move_t mv) {
-  return (mv >> TO_SHIFT) & TO_MASK;
+// Retraces the cached laser of c.  A King that has just been zapped (game
+// over) no longer shoots.
+static void update_laser(position_t *p, const color_t c) {
+  if (ptype_of(p->board[p->kloc[c]]) != KING) {
+    p->laser[c] = 0;
+    p->laser_end[c] = 0;
+    p->laser_crossed[c] = false;
+    return;
+  }
+  p->laser_end[c] = trace_laser(p, c, &p->laser[c], &p->laser_crossed[c]);
 }
 
-inline rot_t rot_of(const move_t mv) {
-  return (rot_t) ((mv >> ROT_SHIFT) & ROT_MASK);
+// Brings the cached lasers up to date after the contents of the squares in
+// touched changed.  A laser depends only on what lies on its own path,
+// shooting King included, so changes elsewhere cannot affect it.
+static void refresh_lasers(position_t *p, const bitboard_t touched) {
+  if (p->laser[WHITE] & touched) {
+    update_laser(p, WHITE);
+  }
+  if (p->laser[BLACK] & touched) {
+    update_laser(p, BLACK);
+  }
 }
+#endif
 
-inline move_t move_of(const ptype_t typ, const rot_t rot, 
-                      const square_t from_sq, const square_t to_sq) {
-  return ((typ & PTYPE_MV_MASK) << PTYPE_MV_SHIFT) |
-      ((rot & ROT_MASK) << ROT_SHIFT) |
-      ((from_sq & FROM_MASK) << FROM_SHIFT) |
-      ((to_sq & TO_MASK) << TO_SHIFT);
+// Rebuild the bitboards and lasers of p from its mailbox.
+void compute_bitboards(position_t *p) {
+#if USE_BITBOARDS
+  p->occ[WHITE] = 0;
+  p->occ[BLACK] = 0;
+  for (fil_t f = 0; f < BOARD_WIDTH; f++) {
+    for (rnk_t r = 0; r < BOARD_WIDTH; r++) {
+      const square_t sq = square_of(f, r);
+      const piece_t x = p->board[sq];
+      if (ptype_of(x) == PAWN || ptype_of(x) == KING) {
+        p->occ[color_of(x)] |= bb_of(sq);
+      }
+    }
+  }
+  update_laser(p, WHITE);
+  update_laser(p, BLACK);
+#endif
 }
 
+// -----------------------------------------------------------------------------
+// Move getters and setters.
+// -----------------------------------------------------------------------------
 
 // converts a move to string notation for FEN
 void move_to_str(const move_t mv, char *buf, const size_t bufsize) {
@@ -373,9 +435,154 @@ int old_generate_all(position_t *p, sortable_move_t *sortable_move_list,
   return move_count;
 }
 
+static square_t fire_mailbox(position_t *p, const color_t fake_color_to_move);
+
+// Where would c's laser end if c moved the piece on from_sq to the empty
+// square to_sq, or rotated it in place by rot?  Applies the move to the board
+// and bitboards only, traces the laser and puts everything back, which is far
+// cheaper than a full make and unmake.
+static square_t zap_after(position_t *p, const color_t c,
+                          const square_t from_sq, const square_t to_sq,
+                          const rot_t rot) {
+  const piece_t from_piece = p->board[from_sq];
+  const piece_t to_piece = p->board[to_sq];
+  const square_t kloc = p->kloc[c];
+#if USE_BITBOARDS
+  const bitboard_t occ = p->occ[c];
+#endif
+
+  tbassert(from_sq == to_sq || ptype_of(to_piece) == EMPTY,
+           "to_piece: %d\n", to_piece);
+
+  if (from_sq == to_sq) {
+    piece_t x = from_piece;
+    set_ori(&x, rot + ori_of(x));
+    p->board[from_sq] = x;
+  } else {
+    p->board[to_sq] = from_piece;
+    p->board[from_sq] = to_piece;
+#if USE_BITBOARDS
+    p->occ[c] ^= bb_of(from_sq) | bb_of(to_sq);
+#endif
+    if (ptype_of(from_piece) == KING) {
+      p->kloc[c] = to_sq;
+    }
+  }
+
+#if USE_BITBOARDS
+  const square_t victim_sq = trace_laser(p, c, NULL, NULL);
+#else
+  const square_t victim_sq = fire_mailbox(p, c);
+#endif
+
+  p->board[from_sq] = from_piece;
+  p->board[to_sq] = to_piece;
+#if USE_BITBOARDS
+  p->occ[c] = occ;
+#endif
+  p->kloc[c] = kloc;
+  return victim_sq;
+}
+
+// Does the move of c from from_sq to to_sq (or rotation by rot) stomp or zap
+// anything?  Stomps are plain to see.  Otherwise only moves that touch c's
+// laser path, King included, can change where the laser ends; those are
+// traced on the board as it would be after the move.  The mailbox build
+// keeps no laser path, so it traces every move.
+static bool is_capture(position_t *p, const color_t c, const square_t from_sq,
+                       const square_t to_sq, const rot_t rot) {
+  if (from_sq != to_sq && ptype_of(p->board[to_sq]) == PAWN) {
+    return true;  // stomp
+  }
+#if USE_BITBOARDS
+  if (!on_laser(p, c, from_sq) && !on_laser(p, c, to_sq)) {
+    return p->laser_end[c] != 0;
+  }
+#endif
+  return zap_after(p, c, from_sq, to_sq, rot) != 0;
+}
+
+// Does the move belong in a list of the given kind?
+static inline bool keep(position_t *p, const gen_kind_t kind, const color_t c,
+                        const square_t from_sq, const square_t to_sq,
+                        const rot_t rot) {
+  return kind == GEN_ALL ||
+      is_capture(p, c, from_sq, to_sq, rot) == (kind == GEN_CAPTURES);
+}
+
+// Will mv stomp or zap anything?
+bool may_capture(position_t *p, const move_t mv) {
+  return is_capture(p, color_to_move_of(p), from_square(mv), to_square(mv),
+                    rot_of(mv));
+}
+
+// Is the pawn of color c on sq pinned by the enemy laser?
+static bool is_pinned(position_t *p, const color_t c, const square_t sq) {
+#if USE_BITBOARDS
+  return bb_test(pinned_of(p, c), sq);
+#else
+  char laser_map[ARR_SIZE];
+  memset(laser_map, 0, sizeof(laser_map));
+  mark_laser_path(p, laser_map, opp_color(c), 1);
+  return laser_map[sq] == 1;
+#endif
+}
+
+// Would generate_all() emit mv at p?  Used to vet moves that come from
+// somewhere other than the generator, such as the hash table and the killer
+// tables.
+bool is_pseudo_legal(position_t *p, const move_t mv) {
+  const color_t c = color_to_move_of(p);
+  const square_t from_sq = from_square(mv);
+  const square_t to_sq = to_square(mv);
+  const rot_t rot = rot_of(mv);
+  const piece_t x = p->board[from_sq];
+
+  if (mv == 0 || ptype_of(x) != ptype_mv_of(mv) || color_of(x) != c) {
+    return false;
+  }
+  if (ptype_of(x) == PAWN && is_pinned(p, c, from_sq)) {
+    return false;
+  }
+  if (from_sq == to_sq) {  // rotation, or the King's null move
+    return rot != NONE || ptype_of(x) == KING;
+  }
+  if (rot != NONE) {
+    return false;
+  }
+
+  bool adjacent = false;
+  for (int d = 0; d < 8; d++) {
+    if (from_sq + dir_of(d) == to_sq) {
+      adjacent = true;
+    }
+  }
+  if (!adjacent) {
+    return false;
+  }
+
+  return dest_legal_table[x][p->board[to_sq]];
+}
+
 int generate_all(position_t *p, sortable_move_t *sortable_move_list,
                  bool strict) {
+  return generate_moves(p, sortable_move_list, GEN_ALL);
+}
+
+// Generate only the moves that stomp or zap something, for quiescence.
+int generate_captures(position_t *p, sortable_move_t *sortable_move_list) {
+  return generate_moves(p, sortable_move_list, GEN_CAPTURES);
+}
+
+// Generate the moves of the given kind from position p, in the same order as
+// generate_all().  Returns number of moves.
+int generate_moves(position_t *p, sortable_move_t *sortable_move_list,
+                   const gen_kind_t kind) {
   color_t color_to_move = color_to_move_of(p);
+#if USE_BITBOARDS
+  // Pawns on the enemy laser path are pinned.
+  const bitboard_t pinned = pinned_of(p, color_to_move);
+#else
   // Make sure that the enemy_laser map is marked
   char laser_map[ARR_SIZE];
 
@@ -391,60 +598,60 @@ int generate_all(position_t *p, sortable_move_t *sortable_move_list,
 
   // 1 = path of laser with no moves
   mark_laser_path(p, laser_map, opp_color(color_to_move), 1);
+#endif
 
   int move_count = 0;
   for(int i = 0; i < NUMBER_PAWNS; i++) {
     square_t sq = p->plocs[color_to_move][i];
     if(sq == 0) continue;
     color_t color = color_to_move;
+#if USE_BITBOARDS
+    if (bb_test(pinned, sq)) continue;
+#else
     if (laser_map[sq] == 1) continue;
+#endif
+    const bool *legal = dest_legal_table[p->board[sq]];
     for (int d = 0; d < 8; d++) {
-            int dest = sq + dir_of(d);
-            // Skip moves into invalid squares, squares occupied by
-            // kings, nonempty squares if x is a king, and squares with
-            // pawns of matching color
-            ptype_t typ = ptype_of(p->board[dest]);
-            if (typ == INVALID ||
-                typ == KING ||
-                (typ == PAWN &&
-                 color == color_of(p->board[dest]))) {
-              continue;    // illegal square
-            }
-
-            WHEN_DEBUG_VERBOSE(char buf[MAX_CHARS_IN_MOVE]);
-            WHEN_DEBUG_VERBOSE({
-                move_to_str(move_of(PAWN, (rot_t) 0, sq, dest), buf, MAX_CHARS_IN_MOVE);
-                DEBUG_LOG(1, "Before: %s ", buf);
-              });
-            tbassert(move_count < MAX_NUM_MOVES, "move_count: %d\n", move_count);
-            sortable_move_list[move_count++] = move_of(PAWN, (rot_t) 0, sq, dest);
-
-            WHEN_DEBUG_VERBOSE({
-                move_to_str(get_move(sortable_move_list[move_count-1]), buf, MAX_CHARS_IN_MOVE);
-                DEBUG_LOG(1, "After: %s\n", buf);
-              });
-          }
+      // The move is written whether or not it is kept, and only counted if
+      // it is: whether a square is open is close to random, so a branch on
+      // it mispredicts.  The list has room for the extra move.
+      const square_t dest = sq + dir_of(d);
+      tbassert(move_count < MAX_NUM_MOVES, "move_count: %d\n", move_count);
+      sortable_move_list[move_count] = move_of(PAWN, (rot_t) 0, sq, dest);
+      move_count += legal[p->board[dest]] &&
+          keep(p, kind, color, sq, dest, NONE);
+    }
 
           // rotations - three directions possible
           for (int rot = 1; rot < 4; ++rot) {
+            if (!keep(p, kind, color, sq, sq, (rot_t) rot)) {
+              continue;
+            }
             tbassert(move_count < MAX_NUM_MOVES, "move_count: %d\n", move_count);
             sortable_move_list[move_count++] = move_of(PAWN, (rot_t) rot, sq, sq);
           }
   }
-  for (int d = 0; d < 8; d++) {
-     int dest = p->kloc[color_to_move] + dir_of(d);
-     // Skip moves into nonempty squares 
-     if ((ptype_of(p->board[dest]) != EMPTY)) {
-        continue;    // illegal square
-     }
-     sortable_move_list[move_count++] = move_of(KING, (rot_t) 0, p->kloc[color_to_move], dest);
+
+  const square_t kloc = p->kloc[color_to_move];
+  const bool *king_legal = dest_legal_table[p->board[kloc]];
+  for (int d = 0; d < 8; d++) {  // written, and counted if kept, as above
+    const square_t dest = kloc + dir_of(d);
+    tbassert(move_count < MAX_NUM_MOVES, "move_count: %d\n", move_count);
+    sortable_move_list[move_count] = move_of(KING, (rot_t) 0, kloc, dest);
+    move_count += king_legal[p->board[dest]] &&
+        keep(p, kind, color_to_move, kloc, dest, NONE);
   }
   for (int rot = 1; rot < 4; ++rot) {
+    if (!keep(p, kind, color_to_move, kloc, kloc, (rot_t) rot)) {
+      continue;
+    }
     tbassert(move_count < MAX_NUM_MOVES, "move_count: %d\n", move_count);
-    sortable_move_list[move_count++] = move_of(KING, (rot_t) rot, p->kloc[color_to_move], p->kloc[color_to_move]);
+    sortable_move_list[move_count++] = move_of(KING, (rot_t) rot, kloc, kloc);
+  }
+  if (keep(p, kind, color_to_move, kloc, kloc, NONE)) {
+    tbassert(move_count < MAX_NUM_MOVES, "move_count: %d\n", move_count);
+    sortable_move_list[move_count++] = move_of(KING, (rot_t) 0, kloc, kloc);
   }
-  tbassert(move_count < MAX_NUM_MOVES, "move_count: %d\n", move_count);
-  sortable_move_list[move_count++] = move_of(KING, (rot_t) 0, p->kloc[color_to_move], p->kloc[color_to_move]);
 
   WHEN_DEBUG_VERBOSE({
       DEBUG_LOG(1, "\nGenerated moves: ");
@@ -459,7 +666,10 @@ int generate_all(position_t *p, sortable_move_t *sortable_move_list,
   return move_count;
 }
 
-square_t low_level_make_move(position_t *old, position_t *p, const move_t mv) {
+// Move phase 1, in place: moves (or rotates) the piece on the from square of
+// mv.  Returns the square of a stomped piece, which the caller must remove,
+// or 0.
+static square_t move_piece(position_t *p, const move_t mv) {
   tbassert(mv != 0, "mv was zero.\n");
 
   square_t stomped_dst_sq = 0;
@@ -470,13 +680,13 @@ square_t low_level_make_move(position_t *old, position_t *p, const move_t mv) {
       DEBUG_LOG(1, "low_level_make_move: %s\n", buf);
     });
 
-  tbassert(old->key == compute_zob_key(old),
-           "old->key: %"PRIu64", zob-key: %"PRIu64"\n",
-           old->key, compute_zob_key(old));
+  tbassert(keys_ok(p),
+           "p->key: %"PRIu64", zob-key: %"PRIu64"\n",
+           p->key, compute_zob_key(p));
 
   WHEN_DEBUG_VERBOSE({
       fprintf(stderr, "Before:\n");
-      display(old);
+      display(p);
     });
 
   square_t from_sq = from_square(mv);
@@ -508,9 +718,6 @@ square_t low_level_make_move(position_t *old, position_t *p, const move_t mv) {
       }
     });
 
-  *p = *old; // needs to copy key
-
-  p->history = old;
   p->last_move = mv;
 
   tbassert(from_sq < ARR_SIZE && from_sq > 0, "from_sq: %d\n", from_sq);
@@ -547,14 +754,23 @@ square_t low_level_make_move(position_t *old, position_t *p, const move_t mv) {
     }
 
     // Hash key updates
-    p->key ^= zob[from_sq][from_piece];  // remove from_piece from from_sq
-    p->key ^= zob[to_sq][to_piece];  // remove to_piece from to_sq
+    toggle_key(p, from_sq, from_piece);  // remove from_piece from from_sq
+    toggle_key(p, to_sq, to_piece);  // remove to_piece from to_sq
 
     p->board[to_sq] = from_piece;  // swap from_piece and to_piece on board
     p->board[from_sq] = to_piece;
 
-    p->key ^= zob[to_sq][from_piece];  // place from_piece in to_sq
-    p->key ^= zob[from_sq][to_piece];  // place to_piece in from_sq
+    toggle_key(p, to_sq, from_piece);  // place from_piece in to_sq
+    toggle_key(p, from_sq, to_piece);  // place to_piece in from_sq
+
+#if USE_BITBOARDS
+    // from_piece always exists; to_piece (if any) belongs to the opponent.
+    const bitboard_t swapped = bb_of(from_sq) | bb_of(to_sq);
+    p->occ[color_of(from_piece)] ^= swapped;
+    if (ptype_of(to_piece) != EMPTY) {
+      p->occ[color_of(to_piece)] ^= swapped;
+    }
+#endif
 
     // Update King locations if necessary
     if (ptype_of(from_piece) == KING) {
@@ -580,16 +796,16 @@ square_t low_level_make_move(position_t *old, position_t *p, const move_t mv) {
     }
   } else {  // rotation
     // remove from_piece from from_sq in hash
-    p->key ^= zob[from_sq][from_piece];
+    toggle_key(p, from_sq, from_piece);
     set_ori(&from_piece, rot + ori_of(from_piece));  // rotate from_piece
     p->board[from_sq] = from_piece;  // place rotated piece on board
-    p->key ^= zob[from_sq][from_piece];              // ... and in hash
+    toggle_key(p, from_sq, from_piece);              // ... and in hash
   }
 
   // Increment ply
   p->ply++;
 
-  tbassert(p->key == compute_zob_key(p),
+  tbassert(keys_ok(p),
            "p->key: %"PRIu64", zob-key: %"PRIu64"\n",
            p->key, compute_zob_key(p));
 
@@ -602,9 +818,9 @@ square_t low_level_make_move(position_t *old, position_t *p, const move_t mv) {
 }
 
 
-// returns square of piece to be removed from board or 0
-square_t fire(position_t *p) {
-  const color_t fake_color_to_move = (color_to_move_of(p) == WHITE) ? BLACK : WHITE;
+
+// Mailbox version of fire(): walks the laser of c's King square by square.
+static square_t fire_mailbox(position_t *p, const color_t fake_color_to_move) {
   square_t sq = p->kloc[fake_color_to_move];
   int8_t bdir = ori_of(p->board[sq]);
 
@@ -640,15 +856,84 @@ square_t fire(position_t *p) {
   }
 }
 
+// returns square of piece to be removed from board or 0
+square_t fire(position_t *p) {
+  const color_t fake_color_to_move = (color_to_move_of(p) == WHITE) ? BLACK : WHITE;
+#if USE_BITBOARDS
+  return zap_target(p, fake_color_to_move);
+#else
+  return fire_mailbox(p, fake_color_to_move);
+#endif
+}
 
-// return victim pieces or KO
-victims_t make_move(position_t *old, position_t *p, const move_t mv) {
+// Removes the piece on sq from the board, the hash key, the pawn locations
+// and the bitboards.  Returns the pawn-location slot the piece occupied, or
+// -1 if it was not a pawn.
+static int8_t remove_piece(position_t *p, const square_t sq) {
+  const piece_t x = p->board[sq];
+  const color_t c = color_of(x);
+  int8_t slot = -1;
+
+  toggle_key(p, sq, x);   // remove from board
+  p->board[sq] = 0;
+  for (int i = 0; i < NUMBER_PAWNS; i++) {
+    if (p->plocs[c][i] == sq) {
+      p->plocs[c][i] = 0;
+      slot = i;
+    }
+  }
+#if USE_BITBOARDS
+  p->occ[c] &= ~bb_of(sq);
+#endif
+  return slot;
+}
+
+// Inverse of remove_piece.  The caller restores the hash key.
+static void restore_piece(position_t *p, const square_t sq, const piece_t x,
+                          const int8_t slot) {
+  p->board[sq] = x;
+  if (slot >= 0) {
+    p->plocs[color_of(x)][slot] = sq;
+  }
+#if USE_BITBOARDS
+  p->occ[color_of(x)] |= bb_of(sq);
+#endif
+}
+
+// Makes mv on p in place and records in undo what undo_move() needs to take
+// it back.  Returns the victims, or KO().  p->history is left alone: callers
+// that need the game history keep it themselves (see make_move() and the key
+// stack in search.h).
+victims_t do_move(position_t *p, const move_t mv, undo_t *undo) {
   tbassert(mv != 0, "mv was zero.\n");
 
   WHEN_DEBUG_VERBOSE(char buf[MAX_CHARS_IN_MOVE]);
 
+  const square_t from_sq = from_square(mv);
+  const square_t to_sq = to_square(mv);
+
+  undo->key = p->key;
+  undo->pawn_key = p->pawn_key;
+  undo->king_key = p->king_key;
+  undo->last_move = p->last_move;
+  undo->victims = p->victims;
+  undo->from_piece = p->board[from_sq];
+  undo->to_piece = p->board[to_sq];
+  undo->from_sq = from_sq;
+  undo->to_sq = to_sq;
+#if USE_BITBOARDS
+  undo->laser[WHITE] = p->laser[WHITE];
+  undo->laser[BLACK] = p->laser[BLACK];
+  undo->laser_end[WHITE] = p->laser_end[WHITE];
+  undo->laser_end[BLACK] = p->laser_end[BLACK];
+  undo->laser_crossed[WHITE] = p->laser_crossed[WHITE];
+  undo->laser_crossed[BLACK] = p->laser_crossed[BLACK];
+#endif
+  undo->stomped_sq = 0;
+  undo->zapped_sq = 0;
+
   // move phase 1 - moving a piece, which may result in a stomp
-  const square_t stomped_sq = low_level_make_move(old, p, mv);
+  const square_t stomped_sq = move_piece(p, mv);
 
   WHEN_DEBUG_VERBOSE({
       if (stomped_sq != 0) {
@@ -663,18 +948,10 @@ victims_t make_move(position_t *old, position_t *p, const move_t mv) {
 
   } else {  // we definitely stomped something
     p->victims.stomped = p->board[stomped_sq];
+    undo->stomped_sq = stomped_sq;
+    undo->stomped_slot = remove_piece(p, stomped_sq);
 
-    const color_t stomped_color = color_of(p->board[stomped_sq]);
-    p->key ^= zob[stomped_sq][p->victims.stomped];   // remove from board
-    p->board[stomped_sq] = 0;
-    for(int i = 0; i < NUMBER_PAWNS; i++) {
-      if(p->plocs[stomped_color][i] == stomped_sq) {
-        p->plocs[stomped_color][i] = 0;
-      }
-    }
-    p->key ^= zob[stomped_sq][p->board[stomped_sq]];
-
-    tbassert(p->key == compute_zob_key(p),
+    tbassert(keys_ok(p),
              "p->key: %"PRIu64", zob-key: %"PRIu64"\n",
              p->key, compute_zob_key(p));
 
@@ -684,6 +961,11 @@ victims_t make_move(position_t *old, position_t *p, const move_t mv) {
       });
   }
 
+#if USE_BITBOARDS
+  // A stomp only ever removes a piece from from_sq.
+  refresh_lasers(p, bb_of(from_sq) | bb_of(to_sq));
+#endif
+
   // move phase 2 - shooting the laser
   const square_t victim_sq = fire(p);
 
@@ -698,23 +980,17 @@ victims_t make_move(position_t *old, position_t *p, const move_t mv) {
     p->victims.zapped = 0;
     if (USE_KO &&  // Ko rule
         zero_victims(p->victims) &&
-        (p->key == (old->key ^ zob_color))) {
-//    if (zero_victims(p->victims) &&
-//        (p->key == (old->key ^ zob_color))) {
+        (p->key == (undo->key ^ zob_color))) {
       return KO();
     }
   } else {  // we definitely hit something with laser
-    color_t zapped_color = color_of(p->board[victim_sq]);
     p->victims.zapped = p->board[victim_sq];
-    p->key ^= zob[victim_sq][p->victims.zapped];   // remove from board
-    p->board[victim_sq] = 0;
-    p->key ^= zob[victim_sq][0];
-    for(int i = 0; i < NUMBER_PAWNS; i++) {
-      if(p->plocs[zapped_color][i] == victim_sq) { 
-        p->plocs[zapped_color][i] = 0;
-      }
-    }
-    tbassert(p->key == compute_zob_key(p),
+    undo->zapped_sq = victim_sq;
+    undo->zapped_slot = remove_piece(p, victim_sq);
+#if USE_BITBOARDS
+    refresh_lasers(p, bb_of(victim_sq));
+#endif
+    tbassert(keys_ok(p),
              "p->key: %"PRIu64", zob-key: %"PRIu64"\n",
              p->key, compute_zob_key(p));
 
@@ -727,71 +1003,556 @@ victims_t make_move(position_t *old, position_t *p, const move_t mv) {
   return p->victims;
 }
 
+// Takes back the move recorded in undo.  Moves must be undone in the reverse
+// order they were made.
+void undo_move(position_t *p, const undo_t *undo) {
+  const square_t from_sq = undo->from_sq;
+  const square_t to_sq = undo->to_sq;
+
+  // Victims come back in the reverse order they were removed.
+  if (undo->zapped_sq != 0) {
+    restore_piece(p, undo->zapped_sq, p->victims.zapped, undo->zapped_slot);
+  }
+  if (undo->stomped_sq != 0) {
+    restore_piece(p, undo->stomped_sq, p->victims.stomped,
+                  undo->stomped_slot);
+  }
+
+  const piece_t from_piece = undo->from_piece;
+  const piece_t to_piece = undo->to_piece;
+  p->board[from_sq] = from_piece;
+
+  if (to_sq != from_sq) {  // move, not rotation
+    p->board[to_sq] = to_piece;
+
+#if USE_BITBOARDS
+    const bitboard_t swapped = bb_of(from_sq) | bb_of(to_sq);
+    p->occ[color_of(from_piece)] ^= swapped;
+    if (ptype_of(to_piece) != EMPTY) {
+      p->occ[color_of(to_piece)] ^= swapped;
+    }
+#endif
+
+    if (ptype_of(from_piece) == KING) {
+      p->kloc[color_of(from_piece)] = from_sq;
+    }
+    if (ptype_of(to_piece) == KING) {
+      p->kloc[color_of(to_piece)] = to_sq;
+    }
+    if (ptype_of(from_piece) == PAWN) {
+      for (int i = 0; i < NUMBER_PAWNS; i++) {
+        if (p->plocs[color_of(from_piece)][i] == to_sq) {
+          p->plocs[color_of(from_piece)][i] = from_sq;
+        }
+      }
+    }
+    if (ptype_of(to_piece) == PAWN) {
+      for (int i = 0; i < NUMBER_PAWNS; i++) {
+        if (p->plocs[color_of(to_piece)][i] == from_sq) {
+          p->plocs[color_of(to_piece)][i] = to_sq;
+        }
+      }
+    }
+  }
+
+#if USE_BITBOARDS
+  p->laser[WHITE] = undo->laser[WHITE];
+  p->laser[BLACK] = undo->laser[BLACK];
+  p->laser_end[WHITE] = undo->laser_end[WHITE];
+  p->laser_end[BLACK] = undo->laser_end[BLACK];
+  p->laser_crossed[WHITE] = undo->laser_crossed[WHITE];
+  p->laser_crossed[BLACK] = undo->laser_crossed[BLACK];
+#endif
+
+  p->key = undo->key;
+  p->pawn_key = undo->pawn_key;
+  p->king_key = undo->king_key;
+  p->ply--;
+  p->last_move = undo->last_move;
+  p->victims = undo->victims;
+
+  tbassert(keys_ok(p),
+           "p->key: %"PRIu64", zob-key: %"PRIu64"\n",
+           p->key, compute_zob_key(p));
+}
+
+// return victim pieces or KO
+victims_t make_move(position_t *old, position_t *p, const move_t mv) {
+  undo_t undo;
+
+  *p = *old;
+  p->history = old;
+  return do_move(p, mv, &undo);
+}
+
+// -----------------------------------------------------------------------------
+// Packed positions
+// -----------------------------------------------------------------------------
+
+_Static_assert(sizeof(packed_position_t) == 32,
+               "packed_position_t must be 32 bytes");
+
+// Orientation bits of entry i of pp->sq[c].
+#define PACKED_ORI_SHIFT(c, i) (2 * ((c) * (1 + NUMBER_PAWNS) + (i)))
+
+void pack_position(const position_t *p, packed_position_t *pp) {
+  memset(pp, 0, sizeof(packed_position_t));
+  for (color_t c = WHITE; c <= BLACK; c++) {
+    // A zapped King stays in kloc but is gone from the board.
+    if (ptype_of(p->board[p->kloc[c]]) == KING) {
+      pp->sq[c][0] = p->kloc[c];
+    }
+
+    // Insertion sort of the (at most NUMBER_PAWNS) pawn squares
+    square_t *pawns = &pp->sq[c][1];
+    int n = 0;
+    for (int i = 0; i < NUMBER_PAWNS; i++) {
+      const square_t sq = p->plocs[c][i];
+      if (sq == 0) {
+        continue;
+      }
+      int j = n++;
+      while (j > 0 && pawns[j - 1] > sq) {
+        pawns[j] = pawns[j - 1];
+        j--;
+      }
+      pawns[j] = sq;
+    }
+
+    for (int i = 0; i < 1 + NUMBER_PAWNS; i++) {
+      if (pp->sq[c][i] != 0) {
+        pp->ori |= (uint32_t) ori_of(p->board[pp->sq[c][i]])
+            << PACKED_ORI_SHIFT(c, i);
+      }
+    }
+  }
+  pp->last_move = p->last_move;
+  pp->ply = p->ply;
+}
+
+// Rebuilds the full position from pp, as fen_to_pos() would from the
+// equivalent FEN.  Returns nonzero if pp does not describe a valid board,
+// which includes the game-over positions whose King was zapped.
+int unpack_position(const packed_position_t *pp, position_t *p) {
+  // Like the sentinels of fen_to_pos(), this one has victims, so history
+  // walks stop here.
+  static position_t sentinel = { .victims = { .stomped = 1, .zapped = 1 } };
+
+  for (int i = 0; i < ARR_SIZE; i++) {
+    p->board[i] = 0;
+    set_ptype(&p->board[i], INVALID);
+  }
+  for (fil_t f = 0; f < BOARD_WIDTH; f++) {
+    for (rnk_t r = 0; r < BOARD_WIDTH; r++) {
+      p->board[square_of(f, r)] = 0;
+    }
+  }
+
+  for (color_t c = WHITE; c <= BLACK; c++) {
+    for (int i = 0; i < 1 + NUMBER_PAWNS; i++) {
+      const square_t sq = pp->sq[c][i];
+      if (i > 0) {
+        p->plocs[c][i - 1] = sq;
+      }
+      if (sq == 0) {
+        if (i == 0) {
+          return 1;  // no King
+        }
+        continue;
+      }
+      if (ptype_of(p->board[sq]) != EMPTY) {
+        return 1;  // off the board, or square already taken
+      }
+      piece_t x = 0;
+      set_ptype(&x, i == 0 ? KING : PAWN);
+      set_color(&x, c);
+      set_ori(&x, pp->ori >> PACKED_ORI_SHIFT(c, i));
+      p->board[sq] = x;
+    }
+    p->kloc[c] = pp->sq[c][0];
+  }
+
+  p->history = &sentinel;
+  p->ply = pp->ply;
+  p->last_move = pp->last_move;
+  p->victims.stomped = 0;
+  p->victims.zapped = 0;
+  compute_bitboards(p);
+  compute_keys(p);
+  return 0;
+}
+
+// Checks that p survives a trip through the packed format.  Returns the
+// number of disagreements found.
+static int verify_packing(position_t *p) {
+  int errors = 0;
+
+  packed_position_t pp;
+  packed_position_t pq;
+  position_t q;
+  pack_position(p, &pp);
+  if (unpack_position(&pp, &q) != 0) {
+    errors++;
+  } else {
+    pack_position(&q, &pq);
+    for (fil_t f = 0; f < BOARD_WIDTH; f++) {
+      for (rnk_t r = 0; r < BOARD_WIDTH; r++) {
+        if (p->board[square_of(f, r)] != q.board[square_of(f, r)]) {
+          errors++;
+        }
+      }
+    }
+    if (memcmp(&pp, &pq, sizeof(packed_position_t)) != 0 ||
+        p->key != q.key || p->pawn_key != q.pawn_key ||
+        p->king_key != q.king_key) {
+      errors++;
+    }
+    // ... and through FEN, which keeps the pieces but not ply or last move.
+    char fen[MAX_FEN_CHARS];
+    pos_to_fen(p, fen);
+    if (fen_to_packed(fen, &pq) != 0 ||
+        memcmp(pp.sq, pq.sq, sizeof(pp.sq)) != 0 || pp.ori != pq.ori ||
+        (pp.ply & 1) != pq.ply) {
+      errors++;
+    }
+#if USE_BITBOARDS
+    for (int c = 0; c < 2; c++) {
+      if (p->occ[c] != q.occ[c] || p->laser[c] != q.laser[c] ||
+          p->laser_end[c] != q.laser_end[c] ||
+          p->laser_crossed[c] != q.laser_crossed[c]) {
+        errors++;
+      }
+    }
+#endif
+  }
+
+  if (errors) {
+    char fen[MAX_FEN_CHARS];
+    pos_to_fen(p, fen);
+    fprintf(stderr, "packed position mismatch at %s\n", fen);
+  }
+  return errors;
+}
+
+#if USE_BITBOARDS
+static int compare_moves(const void *a, const void *b) {
+  const sortable_move_t x = *(const sortable_move_t *) a;
+  const sortable_move_t y = *(const sortable_move_t *) b;
+  return (x > y) - (x < y);
+}
+
+// Cross-checks the bitboard code paths against the mailbox ones at p:
+// occupancy, the cached lasers and the generated move list.  Returns the number
+// of disagreements found.
+static int verify_bitboards(position_t *p) {
+  int errors = 0;
+
+  position_t q = *p;
+  compute_bitboards(&q);
+  if (q.occ[WHITE] != p->occ[WHITE] || q.occ[BLACK] != p->occ[BLACK]) {
+    errors++;
+  }
+
+  for (int c = 0; c < 2; c++) {
+    if (q.laser[c] != p->laser[c] || q.laser_end[c] != p->laser_end[c] ||
+        q.laser_crossed[c] != p->laser_crossed[c] ||
+        p->laser_end[c] != fire_mailbox(p, c)) {
+      errors++;
+    }
+  }
+
+  sortable_move_t fast[MAX_NUM_MOVES];
+  sortable_move_t slow[MAX_NUM_MOVES];
+  const int num_fast = generate_all(p, fast, true);
+  const int num_slow = old_generate_all(p, slow, true);
+  if (num_fast != num_slow) {
+    errors++;
+  } else {
+    qsort(fast, num_fast, sizeof(sortable_move_t), compare_moves);
+    qsort(slow, num_slow, sizeof(sortable_move_t), compare_moves);
+    if (memcmp(fast, slow, num_fast * sizeof(sortable_move_t)) != 0) {
+      errors++;
+    }
+  }
+
+  if (errors) {
+    char fen[MAX_FEN_CHARS];
+    pos_to_fen(p, fen);
+    fprintf(stderr, "bitboard mismatch at %s\n", fen);
+  }
+  return errors;
+}
+#endif
+
+static bool list_contains(const sortable_move_t *lst, const int n,
+                          const move_t mv) {
+  for (int i = 0; i < n; i++) {
+    if (get_move(lst[i]) == mv) {
+      return true;
+    }
+  }
+  return false;
+}
+
+// Checks generate_moves() and is_pseudo_legal() against generate_all() at p:
+// captures and quiets must split the full list, captures must be exactly the
+// moves that destroy something, and every move any piece of the side to move could try must pass
+// is_pseudo_legal() exactly when it was generated.  Returns the number of
+// disagreements found.
+static int verify_generators(position_t *p) {
+  int errors = 0;
+
+  sortable_move_t all[MAX_NUM_MOVES];
+  sortable_move_t captures[MAX_NUM_MOVES];
+  sortable_move_t quiets[MAX_NUM_MOVES];
+  const int num_all = generate_all(p, all, true);
+  const int num_captures = generate_moves(p, captures, GEN_CAPTURES);
+  const int num_quiets = generate_moves(p, quiets, GEN_QUIETS);
+
+  if (num_captures + num_quiets != num_all) {
+    errors++;
+  }
+  for (int i = 0; i < num_all; i++) {
+    const move_t mv = get_move(all[i]);
+    if (list_contains(captures, num_captures, mv) ==
+        list_contains(quiets, num_quiets, mv)) {
+      errors++;
+    }
+  }
+  // A capture is exactly a move whose make reports victims.
+  for (int i = 0; i < num_all; i++) {
+    const move_t mv = get_move(all[i]);
+    position_t q = *p;
+    undo_t undo;
+    do_move(&q, mv, &undo);
+    const bool captured = !zero_victims(q.victims);
+    if (captured != list_contains(captures, num_captures, mv) ||
+        captured != may_capture(p, mv)) {
+      errors++;
+    }
+  }
+
+  const color_t c = color_to_move_of(p);
+  for (int i = -1; i < NUMBER_PAWNS; i++) {
+    const square_t from_sq = (i < 0) ? p->kloc[c] : p->plocs[c][i];
+    if (from_sq == 0) {
+      continue;
+    }
+    for (int d = -1; d < 8; d++) {
+      const square_t to_sq = (d < 0) ? from_sq : from_sq + dir_of(d);
+      for (int typ = PAWN; typ <= KING; typ++) {
+        for (int rot = NONE; rot <= LEFT; rot++) {
+          const move_t mv = move_of(typ, rot, from_sq, to_sq);
+          if (is_pseudo_legal(p, mv) != list_contains(all, num_all, mv)) {
+            errors++;
+          }
+        }
+      }
+    }
+  }
+
+  if (errors) {
+    char fen[MAX_FEN_CHARS];
+    pos_to_fen(p, fen);
+    fprintf(stderr, "move generator mismatch at %s\n", fen);
+  }
+  return errors;
+}
+
+// -----------------------------------------------------------------------------
+// Perft
+// -----------------------------------------------------------------------------
+
+// Subtrees with at least this many plies to go are split across workers;
+// below it perft runs serially, making and unmaking moves in place.
+#define PERFT_PARALLEL_DEPTH 3
+
+// Optional perft hash: leaf counts of subtrees, keyed by position and depth.
+// Workers read and write it without locks, so each entry keeps its count
+// xored into the check word; an entry torn by a racing write fails the check
+// and is simply a miss.
+typedef struct perft_entry {
+  uint64_t check;  // tag ^ count
+  uint64_t count;
+} perft_entry_t;
+
+static perft_entry_t *perft_table = NULL;
+static uint64_t perft_mask = 0;
+
+static inline uint64_t perft_tag(const uint64_t key, const int depth) {
+  return key ^ ((uint64_t) depth * 0x9e3779b97f4a7c15ULL);
+}
+
+static bool perft_probe(const uint64_t key, const int depth, uint64_t *count) {
+  const uint64_t tag = perft_tag(key, depth);
+  const perft_entry_t e = perft_table[tag & perft_mask];
+  if ((e.check ^ e.count) != tag) {
+    return false;
+  }
+  *count = e.count;
+  return true;
+}
+
+static void perft_store(const uint64_t key, const int depth,
+                        const uint64_t count) {
+  const uint64_t tag = perft_tag(key, depth);
+  perft_entry_t *e = &perft_table[tag & perft_mask];
+  e->check = tag ^ count;
+  e->count = count;
+}
+
+static uint64_t perft_search(position_t *p, int depth, int ply, int *errors);
+
+// Leaf count below mv, made in place on p.
+static uint64_t perft_move(position_t *p, const move_t mv, const int depth,
+                           const int ply, int *errors) {
+  undo_t undo;
+  uint64_t count;
+
+  do_move(p, mv, &undo);  // make the move baby!
+
+  // perft ignores Ko, so read the victims off the position.
+  if (ptype_of(p->victims.zapped) == KING) {
+    count = 1;  // do not expand further: hit a King
+  } else {
+    count = perft_search(p, depth - 1, ply + 1, errors);
+  }
+
+  undo_move(p, &undo);
+  return count;
+}
+
+// Leaf counts below each of the num_moves moves in lst, in parallel.
+static void perft_moves(position_t *p, const sortable_move_t *lst,
+                        const int num_moves, const int depth, const int ply,
+                        int *errors, uint64_t *counts) {
+  cilk_for (int i = 0; i < num_moves; i++) {
+    position_t np = *p;  // each worker needs its own copy
+    counts[i] = perft_move(&np, get_move(lst[i]), depth, ply, errors);
+  }
+}
+
+// Adds the mismatches found at interior node p to *errors.
+static void perft_check(position_t *p, int *errors) {
+  if (!keys_ok(p)) {
+    char fen[MAX_FEN_CHARS];
+    pos_to_fen(p, fen);
+    fprintf(stderr, "hash key mismatch at %s\n", fen);
+    __sync_fetch_and_add(errors, 1);
+  }
+  __sync_fetch_and_add(errors, verify_packing(p));
+#if USE_BITBOARDS
+  __sync_fetch_and_add(errors, verify_bitboards(p));
+#endif
+  __sync_fetch_and_add(errors, verify_generators(p));
+}
+
 // helper function for do_perft
 // ply starting with 0
-static uint64_t perft_search(position_t *p, const int depth, const int ply) {
+static uint64_t perft_search(position_t *p, const int depth, const int ply,
+                             int *errors) {
   uint64_t node_count = 0;
-  position_t np;
   sortable_move_t lst[MAX_NUM_MOVES];
-  int i;
 
   if (depth == 0) {
     return 1;
   }
 
+  if (errors != NULL) {
+    perft_check(p, errors);
+  }
+
   const int num_moves = generate_all(p, lst, true);
 
   if (depth == 1) {
     return num_moves;
   }
 
-  for (i = 0; i < num_moves; i++) {
-    move_t mv = get_move(lst[i]);
-
-    const square_t stomped_sq = low_level_make_move(p, &np, mv);  // make the move baby!
-
-    if (stomped_sq != 0) {
-      tbassert(ptype_of(np.board[stomped_sq]) == PAWN,
-               "ptype_of(np.board[stomped_sq]): %d\n",
-               ptype_of(np.board[stomped_sq]));
+  if (perft_table != NULL && perft_probe(p->key, depth, &node_count)) {
+    return node_count;
+  }
 
-      np.victims.stomped = np.board[stomped_sq];
-      np.key ^= zob[stomped_sq][np.victims.stomped];   // remove from board
-      np.board[stomped_sq] = 0;
-      np.key ^= zob[stomped_sq][0];
+  if (depth >= PERFT_PARALLEL_DEPTH) {
+    uint64_t counts[MAX_NUM_MOVES];
+    perft_moves(p, lst, num_moves, depth, ply, errors, counts);
+    for (int i = 0; i < num_moves; i++) {
+      node_count += counts[i];
     }
+  } else {
+    for (int i = 0; i < num_moves; i++) {
+      node_count += perft_move(p, get_move(lst[i]), depth, ply, errors);
+    }
+  }
 
-    square_t victim_sq = fire(&np);  // the guy to disappear
+  if (perft_table != NULL) {
+    perft_store(p->key, depth, node_count);
+  }
+  return node_count;
+}
 
-    if (victim_sq != 0) {            // hit a piece
-      const ptype_t typ = ptype_of(np.board[victim_sq]);
-      tbassert((typ != EMPTY) && (typ != INVALID), "typ: %d\n", typ);
-      if (typ == KING) {  // do not expand further: hit a King
-        node_count++;
-        continue;
-      }
-      np.victims.zapped = np.board[victim_sq];
-      np.key ^= zob[victim_sq][np.victims.zapped];   // remove from board
-      np.board[victim_sq] = 0;
-      np.key ^= zob[victim_sq][0];
-    }
+// perft_search() at the root, for a depth of 1 or more, that also prints the
+// leaf count below each root move.
+static uint64_t perft_divide(position_t *p, const int depth, int *errors) {
+  sortable_move_t lst[MAX_NUM_MOVES];
+  uint64_t counts[MAX_NUM_MOVES];
 
-    const uint64_t partialcount = perft_search(&np, depth-1, ply+1);
-    node_count += partialcount;
+  if (errors != NULL) {
+    perft_check(p, errors);
   }
+  const int num_moves = generate_all(p, lst, true);
+  perft_moves(p, lst, num_moves, depth, 0, errors, counts);
 
+  uint64_t node_count = 0;
+  for (int i = 0; i < num_moves; i++) {
+    char buf[MAX_CHARS_IN_MOVE];
+    move_to_str(get_move(lst[i]), buf, MAX_CHARS_IN_MOVE);
+    printf("%s %" PRIu64 "\n", buf, counts[i]);
+    node_count += counts[i];
+  }
   return node_count;
 }
 
 // help to verify the move generator
-void do_perft(position_t *gme, const int depth, const int ply) {
+//
+// With verify set, every interior node is also checked: the incremental hash
+// keys against recomputed ones, the position against its round trip through
+// the packed format and, in bitboard builds, the bitboard code paths against
+// the mailbox ones.  With divide set, the counts below each root move are
+// printed for the last depth.  hash_mb > 0 backs
+// the count with a perft hash of that many megabytes.
+void do_perft(position_t *gme, const int depth, const int ply,
+              const bool verify, const bool divide, const int hash_mb) {
   fen_to_pos(gme, "");
 
+  if (hash_mb > 0 && !verify) {  // checking must visit every node
+    uint64_t n = 1;
+    while (2 * n * sizeof(perft_entry_t) <= ((uint64_t) hash_mb << 20)) {
+      n *= 2;
+    }
+    perft_table = (perft_entry_t *) calloc(n, sizeof(perft_entry_t));
+    perft_mask = (perft_table != NULL) ? n - 1 : 0;
+  }
+
+  int errors = 0;
   for (int d = 1; d <= depth; d++) {
-    printf("perft %2d ", d);
-    const uint64_t j = perft_search(gme, d, 0);
-    printf("%" PRIu64 "\n", j);
+    const double start = milliseconds();
+    int *e = verify ? &errors : NULL;
+    const uint64_t j = (divide && d == depth) ? perft_divide(gme, d, e)
+                                              : perft_search(gme, d, 0, e);
+    double ms = milliseconds() - start;
+    if (ms < 0.001) {
+      ms = 0.001;  // don't divide by 0
+    }
+    printf("perft %2d %" PRIu64 " time %.0f ms nps %" PRIu64 "\n", d, j, ms,
+           (uint64_t) (j * 1000.0 / ms));
   }
+  if (verify) {
+    printf("perft check: %d mismatches\n", errors);
+  }
+
+  free(perft_table);
+  perft_table = NULL;
+  perft_mask = 0;
 }
 
 void display(position_t *p) {
@@ -812,7 +1573,7 @@ void display(position_t *p) {
     printf("info Last move: NULL\n");
   }
 
-  for (rnk_t r = BOARD_WIDTH - 1; r >=0 ; --r) {
+  for (int r = BOARD_WIDTH - 1; r >= 0; --r) {
     printf("\ninfo %1d  ", r);
     for (fil_t f = 0; f < BOARD_WIDTH; ++f) {
       square_t sq = square_of(f, r);
@@ -850,34 +1611,6 @@ void display(position_t *p) {
   printf("\n\n");
 }
 
-inline victims_t KO() {
-  return ((victims_t) {KO_STOMPED, KO_ZAPPED});
-}
-
-inline victims_t ILLEGAL() {
-  return ((victims_t) {ILLEGAL_STOMPED, ILLEGAL_ZAPPED});
-}
-
-inline bool is_KO(const victims_t victims) {
-  return (victims.stomped == KO_STOMPED) ||
-      (victims.zapped == KO_ZAPPED);
-}
-
-inline bool is_ILLEGAL(const victims_t victims) {
-  return (victims.stomped == ILLEGAL_STOMPED) ||
-      (victims.zapped == ILLEGAL_ZAPPED);
-}
-
-inline bool zero_victims(const victims_t victims) {
-  return (victims.stomped == 0) &&
-      (victims.zapped == 0);
-}
-
-inline bool victim_exists(const victims_t victims) {
-  return (victims.stomped > 0) ||
-      (victims.zapped > 0);
-}
-
 void assert_pawn_locs(position_t * p) {
   /*  for(int c = 0; c < 2; c++) {
     for(int i = 0; i < NUMBER_PAWNS; i++) {
@@ -15,27 +15,51 @@
 #define MAX_CHARS_IN_MOVE 16  // Could be less
 #define MAX_CHARS_IN_TOKEN 64
 
-// the board (which is 8x8 or 10x10) is centered in a 16x16 array
+// The board is BOARD_WIDTH x BOARD_WIDTH, 8 or 10, fixed at compile time
+// (make BOARD_WIDTH=8 builds the 8x8 engine).  It sits in an array 16 ranks
+// wide, so that the file and rank of a square are its two nibbles, inside a
+// border of invalid squares that stops moves and lasers.  The 10x10 board is
+// centered in a 16x16 array; the 8x8 board gets a one-square border and a
+// 10-file array.
+#ifndef BOARD_WIDTH
+#define BOARD_WIDTH 10
+#endif
+#if BOARD_WIDTH == 10
+#define BOARD_ORIGIN 3
+#elif BOARD_WIDTH == 8
+#define BOARD_ORIGIN 1
+#else
+#error "BOARD_WIDTH must be 8 or 10"
+#endif
+
 #define ARR_WIDTH 16
-#define ARR_SIZE (ARR_WIDTH * ARR_WIDTH)
+#define ARR_SIZE (ARR_WIDTH * (BOARD_WIDTH + 2 * BOARD_ORIGIN))
 
-// board is 8 x 8 or 10 x 10
-#define BOARD_WIDTH 10
-// bonus divisor for pcentral method in eval.c
-#define BONUS_DIVISOR 10 / sqrt(2)
-#define BONUS_MULTIPLIER sqrt(2) / 10
 typedef uint8_t square_t;
 typedef uint8_t rnk_t;
 typedef uint8_t fil_t;
 
-#define FIL_ORIGIN ((ARR_WIDTH - BOARD_WIDTH) / 2)
-#define RNK_ORIGIN ((ARR_WIDTH - BOARD_WIDTH) / 2)
+#define FIL_ORIGIN BOARD_ORIGIN
+#define RNK_ORIGIN BOARD_ORIGIN
 
 #define FIL_SHIFT 4
 #define FIL_MASK 15
 #define RNK_SHIFT 0
 #define RNK_MASK 15
 #define NUMBER_PAWNS 7
+
+// The positions set up by "position startpos" and "position endgame"
+#if BOARD_WIDTH == 10
+#define START_FEN \
+  "ss3nw5/3nw2nw3/2nw7/1nw6SE1/nw9/9SE/1nw6SE1/7SE2/3SE2SE3/5SE3NN W"
+#define ENDGAME_FEN "ss9/10/10/10/10/10/10/10/10/9NN W"
+#else
+#define START_FEN "ss2nw4/2nw2nw2/1nw4SE1/nw7/7SE/1nw4SE1/2SE2SE2/4SE2NN W"
+#define ENDGAME_FEN "ss7/8/8/8/8/8/8/7NN W"
+#endif
+
+// Geometry tables generated at build time by table_generator.c
+#include "./precomp_tables.h"
 // -----------------------------------------------------------------------------
 // pieces
 // -----------------------------------------------------------------------------
@@ -119,6 +143,14 @@ typedef enum {
   LEFT
 } rot_t;
 
+// Which moves generate_moves() emits.  Captures are the moves that stomp or
+// zap something; quiets are the rest.
+typedef enum {
+  GEN_ALL,
+  GEN_CAPTURES,
+  GEN_QUIETS
+} gen_kind_t;
+
 // A single move can stomp one piece and zap another.
 typedef struct victims_t {
   piece_t stomped;
@@ -139,6 +171,208 @@ typedef struct victims_t {
 #define ILLEGAL_STOMPED MAX_UINT8_T
 #define ILLEGAL_ZAPPED MAX_UINT8_T
 
+// -----------------------------------------------------------------------------
+// Piece, square and move accessors
+// -----------------------------------------------------------------------------
+
+// These are called everywhere, so they live here where every caller can
+// inline them, and none of them branches.
+
+static inline color_t color_of(const piece_t x) {
+  return (color_t) ((x >> COLOR_SHIFT) & COLOR_MASK);
+}
+
+static inline color_t opp_color(const color_t c) {
+  return (color_t) (c ^ 1);
+}
+
+static inline void set_color(piece_t *x, const color_t c) {
+  *x = ((c & COLOR_MASK) << COLOR_SHIFT) |
+      (*x & ~(COLOR_MASK << COLOR_SHIFT));
+}
+
+static inline ptype_t ptype_of(const piece_t x) {
+  return (ptype_t) ((x >> PTYPE_SHIFT) & PTYPE_MASK);
+}
+
+static inline void set_ptype(piece_t *x, const ptype_t pt) {
+  *x = ((pt & PTYPE_MASK) << PTYPE_SHIFT) |
+      (*x & ~(PTYPE_MASK << PTYPE_SHIFT));
+}
+
+static inline int8_t ori_of(const piece_t x) {
+  return (x >> ORI_SHIFT) & ORI_MASK;
+}
+
+static inline void set_ori(piece_t *x, const int ori) {
+  *x = ((ori & ORI_MASK) << ORI_SHIFT) |
+      (*x & ~(ORI_MASK << ORI_SHIFT));
+}
+
+// For no square, use 0, which is guaranteed to be off board
+static inline square_t square_of(const fil_t f, const rnk_t r) {
+  return ARR_WIDTH * (FIL_ORIGIN + f) + RNK_ORIGIN + r;
+}
+
+// Finds file of square
+static inline fil_t fil_of(const square_t sq) {
+  return ((sq >> FIL_SHIFT) & FIL_MASK) - FIL_ORIGIN;
+}
+
+// Finds rank of square
+static inline rnk_t rnk_of(const square_t sq) {
+  return ((sq >> RNK_SHIFT) & RNK_MASK) - RNK_ORIGIN;
+}
+
+static inline int8_t dir_of(const int i) {
+  return dir_table[i];
+}
+
+static inline int8_t beam_of(const int direction) {
+  return beam_table[direction];
+}
+
+// reflect_table[beam_dir][pawn_orientation]
+// -1 indicates back of Pawn
+static const int8_t reflect_table[NUM_ORI][NUM_ORI] = {
+  //  NW  NE  SE  SW
+  { -1, -1, EE, WW},   // NN
+  { NN, -1, -1, SS},   // EE
+  { WW, EE, -1, -1 },  // SS
+  { -1, NN, SS, -1 }   // WW
+};
+
+static inline int8_t reflect_of(const int beam_dir, const int pawn_ori) {
+  return reflect_table[beam_dir][pawn_ori];
+}
+
+static inline ptype_t ptype_mv_of(const move_t mv) {
+  return (ptype_t) ((mv >> PTYPE_MV_SHIFT) & PTYPE_MV_MASK);
+}
+
+static inline square_t from_square(const move_t mv) {
+  return (mv >> FROM_SHIFT) & FROM_MASK;
+}
+
+static inline square_t to_square(const move_t mv) {
+  return (mv >> TO_SHIFT) & TO_MASK;
+}
+
+static inline rot_t rot_of(const move_t mv) {
+  return (rot_t) ((mv >> ROT_SHIFT) & ROT_MASK);
+}
+
+static inline move_t move_of(const ptype_t typ, const rot_t rot,
+                             const square_t from_sq, const square_t to_sq) {
+  return ((typ & PTYPE_MV_MASK) << PTYPE_MV_SHIFT) |
+      ((rot & ROT_MASK) << ROT_SHIFT) |
+      ((from_sq & FROM_MASK) << FROM_SHIFT) |
+      ((to_sq & TO_MASK) << TO_SHIFT);
+}
+
+static inline victims_t KO() {
+  return ((victims_t) {KO_STOMPED, KO_ZAPPED});
+}
+
+static inline victims_t ILLEGAL() {
+  return ((victims_t) {ILLEGAL_STOMPED, ILLEGAL_ZAPPED});
+}
+
+static inline bool is_KO(const victims_t victims) {
+  return (victims.stomped == KO_STOMPED) |
+      (victims.zapped == KO_ZAPPED);
+}
+
+static inline bool is_ILLEGAL(const victims_t victims) {
+  return (victims.stomped == ILLEGAL_STOMPED) |
+      (victims.zapped == ILLEGAL_ZAPPED);
+}
+
+static inline bool zero_victims(const victims_t victims) {
+  return (victims.stomped | victims.zapped) == 0;
+}
+
+static inline bool victim_exists(const victims_t victims) {
+  return (victims.stomped | victims.zapped) != 0;
+}
+
+// -----------------------------------------------------------------------------
+// bitboards
+// -----------------------------------------------------------------------------
+
+// Build with BITBOARDS=0 (-DUSE_BITBOARDS=0) to fall back to the byte-by-byte
+// mailbox scans in generate_all(), fire() and eval().
+#ifndef USE_BITBOARDS
+#define USE_BITBOARDS 1
+#endif
+
+// One bit per playable square, file-major: bit = fil * BOARD_WIDTH + rnk.
+// 10 x 10 = 100 squares need the 128-bit integer type; 8 x 8 fits a word.
+#if BOARD_WIDTH == 8
+typedef uint64_t bitboard_t;
+#else
+typedef unsigned __int128 bitboard_t;
+#endif
+
+#define BB_ONE ((bitboard_t) 1)
+#define BB_SQUARES (BOARD_WIDTH * BOARD_WIDTH)
+
+// Bit index of a (valid) square of the array.
+static inline int bit_of(const square_t sq) {
+  return bit_of_table[sq];
+}
+
+// Inverse of bit_of.
+static inline square_t square_of_bit(const int b) {
+  return square_of_bit_table[b];
+}
+
+// bb_square[sq]: the bitboard of square sq alone, 0 for squares off the
+// board.  A 128-bit shift by a variable takes several instructions and a
+// branch; this is a load.  Set up by init_bitboards().
+extern bitboard_t bb_square[ARR_SIZE];
+
+static inline bitboard_t bb_of(const square_t sq) {
+  return bb_square[sq];
+}
+
+static inline bool bb_test(const bitboard_t bb, const square_t sq) {
+  return (bb & bb_square[sq]) != 0;
+}
+
+#if BOARD_WIDTH == 8
+// Index of the lowest set bit.  bb must be nonzero.
+static inline int bb_lsb(const bitboard_t bb) {
+  return __builtin_ctzll(bb);
+}
+
+// Index of the highest set bit.  bb must be nonzero.
+static inline int bb_msb(const bitboard_t bb) {
+  return 63 - __builtin_clzll(bb);
+}
+
+static inline int bb_popcount(const bitboard_t bb) {
+  return __builtin_popcountll(bb);
+}
+#else
+// Index of the lowest set bit.  bb must be nonzero.
+static inline int bb_lsb(const bitboard_t bb) {
+  const uint64_t lo = (uint64_t) bb;
+  return lo ? __builtin_ctzll(lo) : 64 + __builtin_ctzll((uint64_t) (bb >> 64));
+}
+
+// Index of the highest set bit.  bb must be nonzero.
+static inline int bb_msb(const bitboard_t bb) {
+  const uint64_t hi = (uint64_t) (bb >> 64);
+  return hi ? 127 - __builtin_clzll(hi) : 63 - __builtin_clzll((uint64_t) bb);
+}
+
+static inline int bb_popcount(const bitboard_t bb) {
+  return __builtin_popcountll((uint64_t) bb) +
+      __builtin_popcountll((uint64_t) (bb >> 64));
+}
+#endif
+
 // -----------------------------------------------------------------------------
 // position
 // -----------------------------------------------------------------------------
@@ -147,55 +381,113 @@ typedef struct position {
   piece_t      board[ARR_SIZE];
   struct position  *history;     // history of position
   uint64_t     key;              // hash key
+  uint64_t     pawn_key;         // hash of the pawns alone
+  uint64_t     king_key;         // hash of the Kings alone
   int16_t      ply;              // Even ply are White, odd are Black
   move_t       last_move;        // move that led to this position
   victims_t    victims;          // pieces destroyed by shooter or stomper
   square_t     kloc[2];          // location of kings
   square_t     plocs[2][NUMBER_PAWNS];
+#if USE_BITBOARDS
+  bitboard_t   occ[2];           // squares occupied by each color
+  bitboard_t   laser[2];         // squares covered by each color's laser
+  square_t     laser_end[2];     // square each laser destroys, or 0
+  bool         laser_crossed[2]; // whether it crosses a square twice
+#endif
 } position_t;
 
+// which color is moving next
+static inline color_t color_to_move_of(const position_t *p) {
+  return (color_t) (p->ply & 1);
+}
+
+#if USE_BITBOARDS
+// The lasers are cached in the position and kept up to date by do_move(),
+// which retraces one only when a move touches a square on its path.
+
+// Is sq on the path of c's laser (c's King included)?
+static inline bool on_laser(const position_t *p, const color_t c,
+                            const square_t sq) {
+  return bb_test(p->laser[c], sq);
+}
+
+// c's pieces that sit on the enemy laser and so cannot move.
+static inline bitboard_t pinned_of(const position_t *p, const color_t c) {
+  return p->laser[c ^ 1] & p->occ[c];
+}
+
+// The square c's laser would destroy if it fired now, or 0.
+static inline square_t zap_target(const position_t *p, const color_t c) {
+  return p->laser_end[c];
+}
+#endif
+
+// A position in 32 bytes, for books, training data and other bulk storage.
+// Each color's King and pawns are listed by square, 0 for none, with the
+// pawns in increasing square order so that equal positions pack to equal
+// bytes.  The orientations of the listed pieces take two bits each in ori,
+// in the same order.  The game history is not kept.
+typedef struct packed_position {
+  square_t     sq[2][1 + NUMBER_PAWNS];  // King, then pawns
+  uint32_t     ori;
+  move_t       last_move;
+  int16_t      ply;
+  uint8_t      reserved[6];            // always 0
+} packed_position_t;
+
+// What undo_move() needs to take back a move made in place by do_move().
+typedef struct undo {
+  uint64_t     key;              // state of the position before the move
+  uint64_t     pawn_key;
+  uint64_t     king_key;
+  move_t       last_move;
+  victims_t    victims;
+  piece_t      from_piece;       // pieces on the from and to squares before
+  piece_t      to_piece;         // the move
+  square_t     from_sq;
+  square_t     to_sq;
+  square_t     stomped_sq;       // where the victims were removed from, or 0
+  square_t     zapped_sq;
+  int8_t       stomped_slot;     // their plocs slots, or -1
+  int8_t       zapped_slot;
+#if USE_BITBOARDS
+  bitboard_t   laser[2];
+  square_t     laser_end[2];
+  bool         laser_crossed[2];
+#endif
+} undo_t;
+
 // -----------------------------------------------------------------------------
 // Function prototypes
 // -----------------------------------------------------------------------------
 
 char *color_to_str(const color_t c);
-color_t color_to_move_of(const position_t *p);
-color_t color_of(const piece_t x);
-color_t opp_color(const color_t c);
-void set_color(piece_t *x, const color_t c);
-ptype_t ptype_of(piece_t x);
-void set_ptype(piece_t *x, ptype_t pt);
-int8_t ori_of(piece_t x);
-void set_ori(piece_t *x, int ori);
 void init_zob();
-square_t square_of(fil_t f, rnk_t r);
-fil_t fil_of(square_t sq);
-rnk_t rnk_of(square_t sq);
+uint64_t zob_signature();
+void init_bitboards();
+void compute_bitboards(position_t *p);
 int square_to_str(square_t sq, char *buf, size_t bufsize);
-int8_t dir_of(int i);
-int8_t beam_of(int direction);
-int8_t reflect_of(int beam_dir, int pawn_ori);
-ptype_t ptype_mv_of(move_t mv);
-square_t from_square(move_t mv);
-square_t to_square(move_t mv);
-rot_t rot_of(move_t mv);
-move_t move_of(ptype_t typ, rot_t rot, square_t from_sq, square_t to_sq);
 void move_to_str(move_t mv, char *buf, size_t bufsize);
 int generate_all(position_t *p, sortable_move_t *sortable_move_list,
                  bool strict);
-void do_perft(position_t *gme, int depth, int ply);
-piece_t low_level_make_move(position_t *old, position_t *p, move_t mv);
+int generate_moves(position_t *p, sortable_move_t *sortable_move_list,
+                   gen_kind_t kind);
+int generate_captures(position_t *p, sortable_move_t *sortable_move_list);
+bool may_capture(position_t *p, move_t mv);
+bool is_pseudo_legal(position_t *p, move_t mv);
+void do_perft(position_t *gme, int depth, int ply, bool verify, bool divide,
+              int hash_mb);
 victims_t make_move(position_t *old, position_t *p, move_t mv);
+victims_t do_move(position_t *p, move_t mv, undo_t *undo);
+void undo_move(position_t *p, const undo_t *undo);
+void pack_position(const position_t *p, packed_position_t *pp);
+int unpack_position(const packed_position_t *pp, position_t *p);
 void display(position_t *p);
-uint64_t compute_zob_key(position_t *p);
-
-victims_t KO();
-victims_t ILLEGAL();
-
-bool is_ILLEGAL(victims_t victims);
-bool is_KO(victims_t victims);
-bool zero_victims(victims_t victims);
-bool victim_exists(victims_t victims);
+uint64_t compute_zob_key(const position_t *p);
+uint64_t compute_pawn_key(const position_t *p);
+uint64_t compute_king_key(const position_t *p);
+void compute_keys(position_t *p);
+uint64_t moved_key(const position_t *p, move_t mv);
 
 void mark_laser_path(position_t *p, char *laser_map, color_t c,
                      char mark_mask);
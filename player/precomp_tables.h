@@ -1,295 +0,0 @@
-#ifndef PRECOMP_TABLES_H
-
-#define PRECOMP_TABLES_H
-//Precomputed Tables to speedup various methods
-static const double pcentral_table[10][10] = {
-{0.200000, 0.292893, 0.367544, 0.416905, 0.434315, 0.434315, 0.416905, 0.367544, 0.292893, 0.200000},
-{0.292893, 0.400000, 0.490098, 0.552786, 0.575736, 0.575736, 0.552786, 0.490098, 0.400000, 0.292893},
-{0.367544, 0.490098, 0.600000, 0.683772, 0.717157, 0.717157, 0.683772, 0.600000, 0.490098, 0.367544},
-{0.416905, 0.552786, 0.683772, 0.800000, 0.858579, 0.858579, 0.800000, 0.683772, 0.552786, 0.416905},
-{0.434315, 0.575736, 0.717157, 0.858579, 1.000000, 1.000000, 0.858579, 0.717157, 0.575736, 0.434315},
-{0.434315, 0.575736, 0.717157, 0.858579, 1.000000, 1.000000, 0.858579, 0.717157, 0.575736, 0.434315},
-{0.416905, 0.552786, 0.683772, 0.800000, 0.858579, 0.858579, 0.800000, 0.683772, 0.552786, 0.416905},
-{0.367544, 0.490098, 0.600000, 0.683772, 0.717157, 0.717157, 0.683772, 0.600000, 0.490098, 0.367544},
-{0.292893, 0.400000, 0.490098, 0.552786, 0.575736, 0.575736, 0.552786, 0.490098, 0.400000, 0.292893},
-{0.200000, 0.292893, 0.367544, 0.416905, 0.434315, 0.434315, 0.416905, 0.367544, 0.292893, 0.200000},
-};
-
-static const unsigned char square_of_table[13][15] = {
-{'\x0', '\x1', '\x2', '\x3', '\x4', '\x5', '\x6', '\x7', '\x8', '\x9', '\xa', '\xb', '\xc', '\xd', '\xe', },
-{'\x10', '\x11', '\x12', '\x13', '\x14', '\x15', '\x16', '\x17', '\x18', '\x19', '\x1a', '\x1b', '\x1c', '\x1d', '\x1e', },
-{'\x20', '\x21', '\x22', '\x23', '\x24', '\x25', '\x26', '\x27', '\x28', '\x29', '\x2a', '\x2b', '\x2c', '\x2d', '\x2e', },
-{'\x30', '\x31', '\x32', '\x33', '\x34', '\x35', '\x36', '\x37', '\x38', '\x39', '\x3a', '\x3b', '\x3c', '\x3d', '\x3e', },
-{'\x40', '\x41', '\x42', '\x43', '\x44', '\x45', '\x46', '\x47', '\x48', '\x49', '\x4a', '\x4b', '\x4c', '\x4d', '\x4e', },
-{'\x50', '\x51', '\x52', '\x53', '\x54', '\x55', '\x56', '\x57', '\x58', '\x59', '\x5a', '\x5b', '\x5c', '\x5d', '\x5e', },
-{'\x60', '\x61', '\x62', '\x63', '\x64', '\x65', '\x66', '\x67', '\x68', '\x69', '\x6a', '\x6b', '\x6c', '\x6d', '\x6e', },
-{'\x70', '\x71', '\x72', '\x73', '\x74', '\x75', '\x76', '\x77', '\x78', '\x79', '\x7a', '\x7b', '\x7c', '\x7d', '\x7e', },
-{'\x80', '\x81', '\x82', '\x83', '\x84', '\x85', '\x86', '\x87', '\x88', '\x89', '\x8a', '\x8b', '\x8c', '\x8d', '\x8e', },
-{'\x90', '\x91', '\x92', '\x93', '\x94', '\x95', '\x96', '\x97', '\x98', '\x99', '\x9a', '\x9b', '\x9c', '\x9d', '\x9e', },
-{'\xa0', '\xa1', '\xa2', '\xa3', '\xa4', '\xa5', '\xa6', '\xa7', '\xa8', '\xa9', '\xaa', '\xab', '\xac', '\xad', '\xae', },
-{'\xb0', '\xb1', '\xb2', '\xb3', '\xb4', '\xb5', '\xb6', '\xb7', '\xb8', '\xb9', '\xba', '\xbb', '\xbc', '\xbd', '\xbe', },
-{'\xc0', '\xc1', '\xc2', '\xc3', '\xc4', '\xc5', '\xc6', '\xc7', '\xc8', '\xc9', '\xca', '\xcb', '\xcc', '\xcd', '\xce', },
-};
-
-static const unsigned char fil_of_table[216] = {
-  -'\x3', -'\x3', -'\x3', -'\x3', -'\x3', -'\x3', -'\x3', -'\x3', -'\x3', -'\x3', -'\x3', -'\x3', 
-  -'\x3', -'\x3', -'\x3', -'\x3', -'\x2', -'\x2', -'\x2', -'\x2', -'\x2', -'\x2', -'\x2', -'\x2', 
-  -'\x2', -'\x2', -'\x2', -'\x2', -'\x2', -'\x2', -'\x2', -'\x2', -'\x1', -'\x1', -'\x1', -'\x1', 
-  -'\x1', -'\x1', -'\x1', -'\x1', -'\x1', -'\x1', -'\x1', -'\x1', -'\x1', -'\x1', -'\x1', -'\x1', 
-  '\x0', '\x0', '\x0', '\x0', '\x0', '\x0', '\x0', '\x0', '\x0', '\x0', '\x0', '\x0', 
-  '\x0', '\x0', '\x0', '\x0', '\x1', '\x1', '\x1', '\x1', '\x1', '\x1', '\x1', '\x1', 
-  '\x1', '\x1', '\x1', '\x1', '\x1', '\x1', '\x1', '\x1', '\x2', '\x2', '\x2', '\x2', 
-  '\x2', '\x2', '\x2', '\x2', '\x2', '\x2', '\x2', '\x2', '\x2', '\x2', '\x2', '\x2', 
-  '\x3', '\x3', '\x3', '\x3', '\x3', '\x3', '\x3', '\x3', '\x3', '\x3', '\x3', '\x3', 
-  '\x3', '\x3', '\x3', '\x3', '\x4', '\x4', '\x4', '\x4', '\x4', '\x4', '\x4', '\x4', 
-  '\x4', '\x4', '\x4', '\x4', '\x4', '\x4', '\x4', '\x4', '\x5', '\x5', '\x5', '\x5', 
-  '\x5', '\x5', '\x5', '\x5', '\x5', '\x5', '\x5', '\x5', '\x5', '\x5', '\x5', '\x5', 
-  '\x6', '\x6', '\x6', '\x6', '\x6', '\x6', '\x6', '\x6', '\x6', '\x6', '\x6', '\x6', 
-  '\x6', '\x6', '\x6', '\x6', '\x7', '\x7', '\x7', '\x7', '\x7', '\x7', '\x7', '\x7', 
-  '\x7', '\x7', '\x7', '\x7', '\x7', '\x7', '\x7', '\x7', '\x8', '\x8', '\x8', '\x8', 
-  '\x8', '\x8', '\x8', '\x8', '\x8', '\x8', '\x8', '\x8', '\x8', '\x8', '\x8', '\x8', 
-  '\x9', '\x9', '\x9', '\x9', '\x9', '\x9', '\x9', '\x9', '\x9', '\x9', '\x9', '\x9', 
-  '\x9', '\x9', '\x9', '\x9', '\xa', '\xa', '\xa', '\xa' 
-};
-
-static const unsigned char rnk_of_table[216] = {
-  -'\x3', -'\x2', -'\x1', '\x0', '\x1', '\x2', '\x3', '\x4', '\x5', '\x6', '\x7', '\x8', 
-  '\x9', '\xa', '\xb', '\xc', -'\x3', -'\x2', -'\x1', '\x0', '\x1', '\x2', '\x3', '\x4', 
-  '\x5', '\x6', '\x7', '\x8', '\x9', '\xa', '\xb', '\xc', -'\x3', -'\x2', -'\x1', '\x0', 
-  '\x1', '\x2', '\x3', '\x4', '\x5', '\x6', '\x7', '\x8', '\x9', '\xa', '\xb', '\xc', 
-  -'\x3', -'\x2', -'\x1', '\x0', '\x1', '\x2', '\x3', '\x4', '\x5', '\x6', '\x7', '\x8', 
-  '\x9', '\xa', '\xb', '\xc', -'\x3', -'\x2', -'\x1', '\x0', '\x1', '\x2', '\x3', '\x4', 
-  '\x5', '\x6', '\x7', '\x8', '\x9', '\xa', '\xb', '\xc', -'\x3', -'\x2', -'\x1', '\x0', 
-  '\x1', '\x2', '\x3', '\x4', '\x5', '\x6', '\x7', '\x8', '\x9', '\xa', '\xb', '\xc', 
-  -'\x3', -'\x2', -'\x1', '\x0', '\x1', '\x2', '\x3', '\x4', '\x5', '\x6', '\x7', '\x8', 
-  '\x9', '\xa', '\xb', '\xc', -'\x3', -'\x2', -'\x1', '\x0', '\x1', '\x2', '\x3', '\x4', 
-  '\x5', '\x6', '\x7', '\x8', '\x9', '\xa', '\xb', '\xc', -'\x3', -'\x2', -'\x1', '\x0', 
-  '\x1', '\x2', '\x3', '\x4', '\x5', '\x6', '\x7', '\x8', '\x9', '\xa', '\xb', '\xc', 
-  -'\x3', -'\x2', -'\x1', '\x0', '\x1', '\x2', '\x3', '\x4', '\x5', '\x6', '\x7', '\x8', 
-  '\x9', '\xa', '\xb', '\xc', -'\x3', -'\x2', -'\x1', '\x0', '\x1', '\x2', '\x3', '\x4', 
-  '\x5', '\x6', '\x7', '\x8', '\x9', '\xa', '\xb', '\xc', -'\x3', -'\x2', -'\x1', '\x0', 
-  '\x1', '\x2', '\x3', '\x4', '\x5', '\x6', '\x7', '\x8', '\x9', '\xa', '\xb', '\xc', 
-  -'\x3', -'\x2', -'\x1', '\x0', '\x1', '\x2', '\x3', '\x4', '\x5', '\x6', '\x7', '\x8', 
-  '\x9', '\xa', '\xb', '\xc', -'\x3', -'\x2', -'\x1', '\x0' 
-};
-
-static const float h_dist_table[216][216] = {
-{2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 1.083333, 1.076923, 1.071429, 1.066667, 1.062500, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 0.566667, 0.562500, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.400000, 0.395833, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.321429, 0.316667, 0.312500, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.271429, 0.266667, 0.262500, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.238095, 0.233333, 0.229167, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.219780, 0.214286, 0.209524, 0.205357, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.208333, 0.201923, 0.196429, 0.191667, 0.187500, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.202020, 0.194444, 0.188034, 0.182540, 0.177778, 0.173611, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.200000, 0.190909, 0.183333, 0.176923, 0.171429, 0.166667, 0.162500, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.215909, 0.202020, 0.190909, 0.181818, 0.174242, 0.167832, 0.162338, 0.157576, 0.153409, 1.083333, 0.583333, 0.416667, 0.333333, 0.283333, 0.250000, 0.226190, 0.208333, 0.194444, 0.183333, 0.174242, 0.166667, 0.160256, 0.154762, 0.150000, 0.145833, 1.076923, 0.576923, 0.410256, 0.326923, 0.276923, 0.243590, 0.219780, 0.201923, 0.188034, 0.176923, 0.167832, 0.160256, 0.153846, 0.148352, 0.143590, 0.139423, 1.071429, 0.571429, 0.404762, 0.321429, 0.271429, 0.238095, 0.214286, 0.196429, },
-{1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 1.083333, 1.076923, 1.071429, 1.066667, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 0.566667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.400000, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.321429, 0.316667, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.271429, 0.266667, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.238095, 0.233333, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.219780, 0.214286, 0.209524, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.208333, 0.201923, 0.196429, 0.191667, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.202020, 0.194444, 0.188034, 0.182540, 0.177778, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.200000, 0.190909, 0.183333, 0.176923, 0.171429, 0.166667, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.215909, 0.202020, 0.190909, 0.181818, 0.174242, 0.167832, 0.162338, 0.157576, 0.583333, 1.083333, 0.583333, 0.416667, 0.333333, 0.283333, 0.250000, 0.226190, 0.208333, 0.194444, 0.183333, 0.174242, 0.166667, 0.160256, 0.154762, 0.150000, 0.576923, 1.076923, 0.576923, 0.410256, 0.326923, 0.276923, 0.243590, 0.219780, 0.201923, 0.188034, 0.176923, 0.167832, 0.160256, 0.153846, 0.148352, 0.143590, 0.571429, 1.071429, 0.571429, 0.404762, 0.321429, 0.271429, 0.238095, 0.214286, },
-{1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 1.083333, 1.076923, 1.071429, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.321429, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.271429, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.238095, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.219780, 0.214286, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.208333, 0.201923, 0.196429, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.202020, 0.194444, 0.188034, 0.182540, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.200000, 0.190909, 0.183333, 0.176923, 0.171429, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.215909, 0.202020, 0.190909, 0.181818, 0.174242, 0.167832, 0.162338, 0.416667, 0.583333, 1.083333, 0.583333, 0.416667, 0.333333, 0.283333, 0.250000, 0.226190, 0.208333, 0.194444, 0.183333, 0.174242, 0.166667, 0.160256, 0.154762, 0.410256, 0.576923, 1.076923, 0.576923, 0.410256, 0.326923, 0.276923, 0.243590, 0.219780, 0.201923, 0.188034, 0.176923, 0.167832, 0.160256, 0.153846, 0.148352, 0.404762, 0.571429, 1.071429, 0.571429, 0.404762, 0.321429, 0.271429, 0.238095, },
-{1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 1.083333, 1.076923, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.219780, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.208333, 0.201923, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.202020, 0.194444, 0.188034, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.200000, 0.190909, 0.183333, 0.176923, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.215909, 0.202020, 0.190909, 0.181818, 0.174242, 0.167832, 0.333333, 0.416667, 0.583333, 1.083333, 0.583333, 0.416667, 0.333333, 0.283333, 0.250000, 0.226190, 0.208333, 0.194444, 0.183333, 0.174242, 0.166667, 0.160256, 0.326923, 0.410256, 0.576923, 1.076923, 0.576923, 0.410256, 0.326923, 0.276923, 0.243590, 0.219780, 0.201923, 0.188034, 0.176923, 0.167832, 0.160256, 0.153846, 0.321429, 0.404762, 0.571429, 1.071429, 0.571429, 0.404762, 0.321429, 0.271429, },
-{1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 1.083333, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.208333, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.202020, 0.194444, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.200000, 0.190909, 0.183333, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.215909, 0.202020, 0.190909, 0.181818, 0.174242, 0.283333, 0.333333, 0.416667, 0.583333, 1.083333, 0.583333, 0.416667, 0.333333, 0.283333, 0.250000, 0.226190, 0.208333, 0.194444, 0.183333, 0.174242, 0.166667, 0.276923, 0.326923, 0.410256, 0.576923, 1.076923, 0.576923, 0.410256, 0.326923, 0.276923, 0.243590, 0.219780, 0.201923, 0.188034, 0.176923, 0.167832, 0.160256, 0.271429, 0.321429, 0.404762, 0.571429, 1.071429, 0.571429, 0.404762, 0.321429, },
-{1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.202020, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.200000, 0.190909, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.215909, 0.202020, 0.190909, 0.181818, 0.250000, 0.283333, 0.333333, 0.416667, 0.583333, 1.083333, 0.583333, 0.416667, 0.333333, 0.283333, 0.250000, 0.226190, 0.208333, 0.194444, 0.183333, 0.174242, 0.243590, 0.276923, 0.326923, 0.410256, 0.576923, 1.076923, 0.576923, 0.410256, 0.326923, 0.276923, 0.243590, 0.219780, 0.201923, 0.188034, 0.176923, 0.167832, 0.238095, 0.271429, 0.321429, 0.404762, 0.571429, 1.071429, 0.571429, 0.404762, },
-{1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.200000, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.215909, 0.202020, 0.190909, 0.226190, 0.250000, 0.283333, 0.333333, 0.416667, 0.583333, 1.083333, 0.583333, 0.416667, 0.333333, 0.283333, 0.250000, 0.226190, 0.208333, 0.194444, 0.183333, 0.219780, 0.243590, 0.276923, 0.326923, 0.410256, 0.576923, 1.076923, 0.576923, 0.410256, 0.326923, 0.276923, 0.243590, 0.219780, 0.201923, 0.188034, 0.176923, 0.214286, 0.238095, 0.271429, 0.321429, 0.404762, 0.571429, 1.071429, 0.571429, },
-{1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.215909, 0.202020, 0.208333, 0.226190, 0.250000, 0.283333, 0.333333, 0.416667, 0.583333, 1.083333, 0.583333, 0.416667, 0.333333, 0.283333, 0.250000, 0.226190, 0.208333, 0.194444, 0.201923, 0.219780, 0.243590, 0.276923, 0.326923, 0.410256, 0.576923, 1.076923, 0.576923, 0.410256, 0.326923, 0.276923, 0.243590, 0.219780, 0.201923, 0.188034, 0.196429, 0.214286, 0.238095, 0.271429, 0.321429, 0.404762, 0.571429, 1.071429, },
-{1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.202020, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.215909, 0.194444, 0.208333, 0.226190, 0.250000, 0.283333, 0.333333, 0.416667, 0.583333, 1.083333, 0.583333, 0.416667, 0.333333, 0.283333, 0.250000, 0.226190, 0.208333, 0.188034, 0.201923, 0.219780, 0.243590, 0.276923, 0.326923, 0.410256, 0.576923, 1.076923, 0.576923, 0.410256, 0.326923, 0.276923, 0.243590, 0.219780, 0.201923, 0.182540, 0.196429, 0.214286, 0.238095, 0.271429, 0.321429, 0.404762, 0.571429, },
-{1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.200000, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.190909, 0.202020, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.183333, 0.194444, 0.208333, 0.226190, 0.250000, 0.283333, 0.333333, 0.416667, 0.583333, 1.083333, 0.583333, 0.416667, 0.333333, 0.283333, 0.250000, 0.226190, 0.176923, 0.188034, 0.201923, 0.219780, 0.243590, 0.276923, 0.326923, 0.410256, 0.576923, 1.076923, 0.576923, 0.410256, 0.326923, 0.276923, 0.243590, 0.219780, 0.171429, 0.182540, 0.196429, 0.214286, 0.238095, 0.271429, 0.321429, 0.404762, },
-{1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.202020, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.190909, 0.200000, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.181818, 0.190909, 0.202020, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.174242, 0.183333, 0.194444, 0.208333, 0.226190, 0.250000, 0.283333, 0.333333, 0.416667, 0.583333, 1.083333, 0.583333, 0.416667, 0.333333, 0.283333, 0.250000, 0.167832, 0.176923, 0.188034, 0.201923, 0.219780, 0.243590, 0.276923, 0.326923, 0.410256, 0.576923, 1.076923, 0.576923, 0.410256, 0.326923, 0.276923, 0.243590, 0.162338, 0.171429, 0.182540, 0.196429, 0.214286, 0.238095, 0.271429, 0.321429, },
-{1.083333, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.208333, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.194444, 0.202020, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.183333, 0.190909, 0.200000, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.174242, 0.181818, 0.190909, 0.202020, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.166667, 0.174242, 0.183333, 0.194444, 0.208333, 0.226190, 0.250000, 0.283333, 0.333333, 0.416667, 0.583333, 1.083333, 0.583333, 0.416667, 0.333333, 0.283333, 0.160256, 0.167832, 0.176923, 0.188034, 0.201923, 0.219780, 0.243590, 0.276923, 0.326923, 0.410256, 0.576923, 1.076923, 0.576923, 0.410256, 0.326923, 0.276923, 0.154762, 0.162338, 0.171429, 0.182540, 0.196429, 0.214286, 0.238095, 0.271429, },
-{1.076923, 1.083333, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.219780, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.201923, 0.208333, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.188034, 0.194444, 0.202020, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.176923, 0.183333, 0.190909, 0.200000, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.167832, 0.174242, 0.181818, 0.190909, 0.202020, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.160256, 0.166667, 0.174242, 0.183333, 0.194444, 0.208333, 0.226190, 0.250000, 0.283333, 0.333333, 0.416667, 0.583333, 1.083333, 0.583333, 0.416667, 0.333333, 0.153846, 0.160256, 0.167832, 0.176923, 0.188034, 0.201923, 0.219780, 0.243590, 0.276923, 0.326923, 0.410256, 0.576923, 1.076923, 0.576923, 0.410256, 0.326923, 0.148352, 0.154762, 0.162338, 0.171429, 0.182540, 0.196429, 0.214286, 0.238095, },
-{1.071429, 1.076923, 1.083333, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.321429, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.271429, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.238095, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.214286, 0.219780, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.196429, 0.201923, 0.208333, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.182540, 0.188034, 0.194444, 0.202020, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.171429, 0.176923, 0.183333, 0.190909, 0.200000, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.162338, 0.167832, 0.174242, 0.181818, 0.190909, 0.202020, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.154762, 0.160256, 0.166667, 0.174242, 0.183333, 0.194444, 0.208333, 0.226190, 0.250000, 0.283333, 0.333333, 0.416667, 0.583333, 1.083333, 0.583333, 0.416667, 0.148352, 0.153846, 0.160256, 0.167832, 0.176923, 0.188034, 0.201923, 0.219780, 0.243590, 0.276923, 0.326923, 0.410256, 0.576923, 1.076923, 0.576923, 0.410256, 0.142857, 0.148352, 0.154762, 0.162338, 0.171429, 0.182540, 0.196429, 0.214286, },
-{1.066667, 1.071429, 1.076923, 1.083333, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 0.566667, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.400000, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.316667, 0.321429, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.266667, 0.271429, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.233333, 0.238095, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.209524, 0.214286, 0.219780, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.191667, 0.196429, 0.201923, 0.208333, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.177778, 0.182540, 0.188034, 0.194444, 0.202020, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.166667, 0.171429, 0.176923, 0.183333, 0.190909, 0.200000, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.157576, 0.162338, 0.167832, 0.174242, 0.181818, 0.190909, 0.202020, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.150000, 0.154762, 0.160256, 0.166667, 0.174242, 0.183333, 0.194444, 0.208333, 0.226190, 0.250000, 0.283333, 0.333333, 0.416667, 0.583333, 1.083333, 0.583333, 0.143590, 0.148352, 0.153846, 0.160256, 0.167832, 0.176923, 0.188034, 0.201923, 0.219780, 0.243590, 0.276923, 0.326923, 0.410256, 0.576923, 1.076923, 0.576923, 0.138095, 0.142857, 0.148352, 0.154762, 0.162338, 0.171429, 0.182540, 0.196429, },
-{1.062500, 1.066667, 1.071429, 1.076923, 1.083333, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 0.562500, 0.566667, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 0.395833, 0.400000, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.312500, 0.316667, 0.321429, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.262500, 0.266667, 0.271429, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.229167, 0.233333, 0.238095, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.205357, 0.209524, 0.214286, 0.219780, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.187500, 0.191667, 0.196429, 0.201923, 0.208333, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.173611, 0.177778, 0.182540, 0.188034, 0.194444, 0.202020, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.162500, 0.166667, 0.171429, 0.176923, 0.183333, 0.190909, 0.200000, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.153409, 0.157576, 0.162338, 0.167832, 0.174242, 0.181818, 0.190909, 0.202020, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.145833, 0.150000, 0.154762, 0.160256, 0.166667, 0.174242, 0.183333, 0.194444, 0.208333, 0.226190, 0.250000, 0.283333, 0.333333, 0.416667, 0.583333, 1.083333, 0.139423, 0.143590, 0.148352, 0.153846, 0.160256, 0.167832, 0.176923, 0.188034, 0.201923, 0.219780, 0.243590, 0.276923, 0.326923, 0.410256, 0.576923, 1.076923, 0.133929, 0.138095, 0.142857, 0.148352, 0.154762, 0.162338, 0.171429, 0.182540, },
-{1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 0.566667, 0.562500, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 1.083333, 1.076923, 1.071429, 1.066667, 1.062500, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 0.566667, 0.562500, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.400000, 0.395833, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.321429, 0.316667, 0.312500, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.271429, 0.266667, 0.262500, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.238095, 0.233333, 0.229167, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.219780, 0.214286, 0.209524, 0.205357, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.208333, 0.201923, 0.196429, 0.191667, 0.187500, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.202020, 0.194444, 0.188034, 0.182540, 0.177778, 0.173611, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.200000, 0.190909, 0.183333, 0.176923, 0.171429, 0.166667, 0.162500, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.215909, 0.202020, 0.190909, 0.181818, 0.174242, 0.167832, 0.162338, 0.157576, 0.153409, 1.083333, 0.583333, 0.416667, 0.333333, 0.283333, 0.250000, 0.226190, 0.208333, 0.194444, 0.183333, 0.174242, 0.166667, 0.160256, 0.154762, 0.150000, 0.145833, 1.076923, 0.576923, 0.410256, 0.326923, 0.276923, 0.243590, 0.219780, 0.201923, },
-{1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 0.566667, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 1.083333, 1.076923, 1.071429, 1.066667, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 0.566667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.400000, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.321429, 0.316667, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.271429, 0.266667, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.238095, 0.233333, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.219780, 0.214286, 0.209524, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.208333, 0.201923, 0.196429, 0.191667, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.202020, 0.194444, 0.188034, 0.182540, 0.177778, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.200000, 0.190909, 0.183333, 0.176923, 0.171429, 0.166667, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.215909, 0.202020, 0.190909, 0.181818, 0.174242, 0.167832, 0.162338, 0.157576, 0.583333, 1.083333, 0.583333, 0.416667, 0.333333, 0.283333, 0.250000, 0.226190, 0.208333, 0.194444, 0.183333, 0.174242, 0.166667, 0.160256, 0.154762, 0.150000, 0.576923, 1.076923, 0.576923, 0.410256, 0.326923, 0.276923, 0.243590, 0.219780, },
-{0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 1.083333, 1.076923, 1.071429, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.321429, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.271429, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.238095, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.219780, 0.214286, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.208333, 0.201923, 0.196429, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.202020, 0.194444, 0.188034, 0.182540, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.200000, 0.190909, 0.183333, 0.176923, 0.171429, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.215909, 0.202020, 0.190909, 0.181818, 0.174242, 0.167832, 0.162338, 0.416667, 0.583333, 1.083333, 0.583333, 0.416667, 0.333333, 0.283333, 0.250000, 0.226190, 0.208333, 0.194444, 0.183333, 0.174242, 0.166667, 0.160256, 0.154762, 0.410256, 0.576923, 1.076923, 0.576923, 0.410256, 0.326923, 0.276923, 0.243590, },
-{0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 1.083333, 1.076923, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.219780, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.208333, 0.201923, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.202020, 0.194444, 0.188034, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.200000, 0.190909, 0.183333, 0.176923, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.215909, 0.202020, 0.190909, 0.181818, 0.174242, 0.167832, 0.333333, 0.416667, 0.583333, 1.083333, 0.583333, 0.416667, 0.333333, 0.283333, 0.250000, 0.226190, 0.208333, 0.194444, 0.183333, 0.174242, 0.166667, 0.160256, 0.326923, 0.410256, 0.576923, 1.076923, 0.576923, 0.410256, 0.326923, 0.276923, },
-{0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 1.083333, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.208333, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.202020, 0.194444, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.200000, 0.190909, 0.183333, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.215909, 0.202020, 0.190909, 0.181818, 0.174242, 0.283333, 0.333333, 0.416667, 0.583333, 1.083333, 0.583333, 0.416667, 0.333333, 0.283333, 0.250000, 0.226190, 0.208333, 0.194444, 0.183333, 0.174242, 0.166667, 0.276923, 0.326923, 0.410256, 0.576923, 1.076923, 0.576923, 0.410256, 0.326923, },
-{0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.202020, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.200000, 0.190909, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.215909, 0.202020, 0.190909, 0.181818, 0.250000, 0.283333, 0.333333, 0.416667, 0.583333, 1.083333, 0.583333, 0.416667, 0.333333, 0.283333, 0.250000, 0.226190, 0.208333, 0.194444, 0.183333, 0.174242, 0.243590, 0.276923, 0.326923, 0.410256, 0.576923, 1.076923, 0.576923, 0.410256, },
-{0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.200000, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.215909, 0.202020, 0.190909, 0.226190, 0.250000, 0.283333, 0.333333, 0.416667, 0.583333, 1.083333, 0.583333, 0.416667, 0.333333, 0.283333, 0.250000, 0.226190, 0.208333, 0.194444, 0.183333, 0.219780, 0.243590, 0.276923, 0.326923, 0.410256, 0.576923, 1.076923, 0.576923, },
-{0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.215909, 0.202020, 0.208333, 0.226190, 0.250000, 0.283333, 0.333333, 0.416667, 0.583333, 1.083333, 0.583333, 0.416667, 0.333333, 0.283333, 0.250000, 0.226190, 0.208333, 0.194444, 0.201923, 0.219780, 0.243590, 0.276923, 0.326923, 0.410256, 0.576923, 1.076923, },
-{0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.202020, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.215909, 0.194444, 0.208333, 0.226190, 0.250000, 0.283333, 0.333333, 0.416667, 0.583333, 1.083333, 0.583333, 0.416667, 0.333333, 0.283333, 0.250000, 0.226190, 0.208333, 0.188034, 0.201923, 0.219780, 0.243590, 0.276923, 0.326923, 0.410256, 0.576923, },
-{0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.200000, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.190909, 0.202020, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.183333, 0.194444, 0.208333, 0.226190, 0.250000, 0.283333, 0.333333, 0.416667, 0.583333, 1.083333, 0.583333, 0.416667, 0.333333, 0.283333, 0.250000, 0.226190, 0.176923, 0.188034, 0.201923, 0.219780, 0.243590, 0.276923, 0.326923, 0.410256, },
-{0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.202020, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.190909, 0.200000, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.181818, 0.190909, 0.202020, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.174242, 0.183333, 0.194444, 0.208333, 0.226190, 0.250000, 0.283333, 0.333333, 0.416667, 0.583333, 1.083333, 0.583333, 0.416667, 0.333333, 0.283333, 0.250000, 0.167832, 0.176923, 0.188034, 0.201923, 0.219780, 0.243590, 0.276923, 0.326923, },
-{0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 1.083333, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.208333, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.194444, 0.202020, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.183333, 0.190909, 0.200000, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.174242, 0.181818, 0.190909, 0.202020, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.166667, 0.174242, 0.183333, 0.194444, 0.208333, 0.226190, 0.250000, 0.283333, 0.333333, 0.416667, 0.583333, 1.083333, 0.583333, 0.416667, 0.333333, 0.283333, 0.160256, 0.167832, 0.176923, 0.188034, 0.201923, 0.219780, 0.243590, 0.276923, },
-{0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 1.076923, 1.083333, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.219780, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.201923, 0.208333, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.188034, 0.194444, 0.202020, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.176923, 0.183333, 0.190909, 0.200000, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.167832, 0.174242, 0.181818, 0.190909, 0.202020, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.160256, 0.166667, 0.174242, 0.183333, 0.194444, 0.208333, 0.226190, 0.250000, 0.283333, 0.333333, 0.416667, 0.583333, 1.083333, 0.583333, 0.416667, 0.333333, 0.153846, 0.160256, 0.167832, 0.176923, 0.188034, 0.201923, 0.219780, 0.243590, },
-{0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 1.071429, 1.076923, 1.083333, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.321429, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.271429, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.238095, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.214286, 0.219780, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.196429, 0.201923, 0.208333, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.182540, 0.188034, 0.194444, 0.202020, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.171429, 0.176923, 0.183333, 0.190909, 0.200000, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.162338, 0.167832, 0.174242, 0.181818, 0.190909, 0.202020, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.154762, 0.160256, 0.166667, 0.174242, 0.183333, 0.194444, 0.208333, 0.226190, 0.250000, 0.283333, 0.333333, 0.416667, 0.583333, 1.083333, 0.583333, 0.416667, 0.148352, 0.153846, 0.160256, 0.167832, 0.176923, 0.188034, 0.201923, 0.219780, },
-{0.566667, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 1.066667, 1.071429, 1.076923, 1.083333, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 0.566667, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.400000, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.316667, 0.321429, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.266667, 0.271429, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.233333, 0.238095, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.209524, 0.214286, 0.219780, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.191667, 0.196429, 0.201923, 0.208333, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.177778, 0.182540, 0.188034, 0.194444, 0.202020, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.166667, 0.171429, 0.176923, 0.183333, 0.190909, 0.200000, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.157576, 0.162338, 0.167832, 0.174242, 0.181818, 0.190909, 0.202020, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.150000, 0.154762, 0.160256, 0.166667, 0.174242, 0.183333, 0.194444, 0.208333, 0.226190, 0.250000, 0.283333, 0.333333, 0.416667, 0.583333, 1.083333, 0.583333, 0.143590, 0.148352, 0.153846, 0.160256, 0.167832, 0.176923, 0.188034, 0.201923, },
-{0.562500, 0.566667, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.062500, 1.066667, 1.071429, 1.076923, 1.083333, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 0.562500, 0.566667, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 0.395833, 0.400000, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.312500, 0.316667, 0.321429, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.262500, 0.266667, 0.271429, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.229167, 0.233333, 0.238095, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.205357, 0.209524, 0.214286, 0.219780, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.187500, 0.191667, 0.196429, 0.201923, 0.208333, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.173611, 0.177778, 0.182540, 0.188034, 0.194444, 0.202020, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.162500, 0.166667, 0.171429, 0.176923, 0.183333, 0.190909, 0.200000, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.153409, 0.157576, 0.162338, 0.167832, 0.174242, 0.181818, 0.190909, 0.202020, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.145833, 0.150000, 0.154762, 0.160256, 0.166667, 0.174242, 0.183333, 0.194444, 0.208333, 0.226190, 0.250000, 0.283333, 0.333333, 0.416667, 0.583333, 1.083333, 0.139423, 0.143590, 0.148352, 0.153846, 0.160256, 0.167832, 0.176923, 0.188034, },
-{1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.400000, 0.395833, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 0.566667, 0.562500, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 1.083333, 1.076923, 1.071429, 1.066667, 1.062500, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 0.566667, 0.562500, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.400000, 0.395833, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.321429, 0.316667, 0.312500, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.271429, 0.266667, 0.262500, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.238095, 0.233333, 0.229167, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.219780, 0.214286, 0.209524, 0.205357, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.208333, 0.201923, 0.196429, 0.191667, 0.187500, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.202020, 0.194444, 0.188034, 0.182540, 0.177778, 0.173611, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.200000, 0.190909, 0.183333, 0.176923, 0.171429, 0.166667, 0.162500, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.215909, 0.202020, 0.190909, 0.181818, 0.174242, 0.167832, 0.162338, 0.157576, 0.153409, 1.083333, 0.583333, 0.416667, 0.333333, 0.283333, 0.250000, 0.226190, 0.208333, },
-{0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.400000, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 0.566667, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 1.083333, 1.076923, 1.071429, 1.066667, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 0.566667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.400000, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.321429, 0.316667, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.271429, 0.266667, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.238095, 0.233333, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.219780, 0.214286, 0.209524, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.208333, 0.201923, 0.196429, 0.191667, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.202020, 0.194444, 0.188034, 0.182540, 0.177778, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.200000, 0.190909, 0.183333, 0.176923, 0.171429, 0.166667, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.215909, 0.202020, 0.190909, 0.181818, 0.174242, 0.167832, 0.162338, 0.157576, 0.583333, 1.083333, 0.583333, 0.416667, 0.333333, 0.283333, 0.250000, 0.226190, },
-{0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 1.083333, 1.076923, 1.071429, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.321429, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.271429, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.238095, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.219780, 0.214286, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.208333, 0.201923, 0.196429, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.202020, 0.194444, 0.188034, 0.182540, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.200000, 0.190909, 0.183333, 0.176923, 0.171429, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.215909, 0.202020, 0.190909, 0.181818, 0.174242, 0.167832, 0.162338, 0.416667, 0.583333, 1.083333, 0.583333, 0.416667, 0.333333, 0.283333, 0.250000, },
-{0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 1.083333, 1.076923, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.219780, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.208333, 0.201923, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.202020, 0.194444, 0.188034, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.200000, 0.190909, 0.183333, 0.176923, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.215909, 0.202020, 0.190909, 0.181818, 0.174242, 0.167832, 0.333333, 0.416667, 0.583333, 1.083333, 0.583333, 0.416667, 0.333333, 0.283333, },
-{0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 1.083333, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.208333, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.202020, 0.194444, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.200000, 0.190909, 0.183333, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.215909, 0.202020, 0.190909, 0.181818, 0.174242, 0.283333, 0.333333, 0.416667, 0.583333, 1.083333, 0.583333, 0.416667, 0.333333, },
-{0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.202020, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.200000, 0.190909, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.215909, 0.202020, 0.190909, 0.181818, 0.250000, 0.283333, 0.333333, 0.416667, 0.583333, 1.083333, 0.583333, 0.416667, },
-{0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.200000, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.215909, 0.202020, 0.190909, 0.226190, 0.250000, 0.283333, 0.333333, 0.416667, 0.583333, 1.083333, 0.583333, },
-{0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.215909, 0.202020, 0.208333, 0.226190, 0.250000, 0.283333, 0.333333, 0.416667, 0.583333, 1.083333, },
-{0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.202020, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.215909, 0.194444, 0.208333, 0.226190, 0.250000, 0.283333, 0.333333, 0.416667, 0.583333, },
-{0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.200000, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.190909, 0.202020, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.183333, 0.194444, 0.208333, 0.226190, 0.250000, 0.283333, 0.333333, 0.416667, },
-{0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.202020, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.190909, 0.200000, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.181818, 0.190909, 0.202020, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.174242, 0.183333, 0.194444, 0.208333, 0.226190, 0.250000, 0.283333, 0.333333, },
-{0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 1.083333, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.208333, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.194444, 0.202020, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.183333, 0.190909, 0.200000, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.174242, 0.181818, 0.190909, 0.202020, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.166667, 0.174242, 0.183333, 0.194444, 0.208333, 0.226190, 0.250000, 0.283333, },
-{0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 1.076923, 1.083333, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.219780, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.201923, 0.208333, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.188034, 0.194444, 0.202020, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.176923, 0.183333, 0.190909, 0.200000, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.167832, 0.174242, 0.181818, 0.190909, 0.202020, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.160256, 0.166667, 0.174242, 0.183333, 0.194444, 0.208333, 0.226190, 0.250000, },
-{0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 1.071429, 1.076923, 1.083333, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.321429, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.271429, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.238095, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.214286, 0.219780, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.196429, 0.201923, 0.208333, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.182540, 0.188034, 0.194444, 0.202020, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.171429, 0.176923, 0.183333, 0.190909, 0.200000, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.162338, 0.167832, 0.174242, 0.181818, 0.190909, 0.202020, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.154762, 0.160256, 0.166667, 0.174242, 0.183333, 0.194444, 0.208333, 0.226190, },
-{0.400000, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.566667, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 1.066667, 1.071429, 1.076923, 1.083333, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 0.566667, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.400000, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.316667, 0.321429, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.266667, 0.271429, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.233333, 0.238095, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.209524, 0.214286, 0.219780, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.191667, 0.196429, 0.201923, 0.208333, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.177778, 0.182540, 0.188034, 0.194444, 0.202020, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.166667, 0.171429, 0.176923, 0.183333, 0.190909, 0.200000, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.157576, 0.162338, 0.167832, 0.174242, 0.181818, 0.190909, 0.202020, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.150000, 0.154762, 0.160256, 0.166667, 0.174242, 0.183333, 0.194444, 0.208333, },
-{0.395833, 0.400000, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.562500, 0.566667, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.062500, 1.066667, 1.071429, 1.076923, 1.083333, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 0.562500, 0.566667, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 0.395833, 0.400000, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.312500, 0.316667, 0.321429, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.262500, 0.266667, 0.271429, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.229167, 0.233333, 0.238095, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.205357, 0.209524, 0.214286, 0.219780, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.187500, 0.191667, 0.196429, 0.201923, 0.208333, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.173611, 0.177778, 0.182540, 0.188034, 0.194444, 0.202020, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.162500, 0.166667, 0.171429, 0.176923, 0.183333, 0.190909, 0.200000, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.153409, 0.157576, 0.162338, 0.167832, 0.174242, 0.181818, 0.190909, 0.202020, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.145833, 0.150000, 0.154762, 0.160256, 0.166667, 0.174242, 0.183333, 0.194444, },
-{1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.321429, 0.316667, 0.312500, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.400000, 0.395833, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 0.566667, 0.562500, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 1.083333, 1.076923, 1.071429, 1.066667, 1.062500, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 0.566667, 0.562500, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.400000, 0.395833, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.321429, 0.316667, 0.312500, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.271429, 0.266667, 0.262500, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.238095, 0.233333, 0.229167, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.219780, 0.214286, 0.209524, 0.205357, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.208333, 0.201923, 0.196429, 0.191667, 0.187500, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.202020, 0.194444, 0.188034, 0.182540, 0.177778, 0.173611, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.200000, 0.190909, 0.183333, 0.176923, 0.171429, 0.166667, 0.162500, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.215909, },
-{0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.321429, 0.316667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.400000, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 0.566667, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 1.083333, 1.076923, 1.071429, 1.066667, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 0.566667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.400000, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.321429, 0.316667, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.271429, 0.266667, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.238095, 0.233333, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.219780, 0.214286, 0.209524, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.208333, 0.201923, 0.196429, 0.191667, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.202020, 0.194444, 0.188034, 0.182540, 0.177778, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.200000, 0.190909, 0.183333, 0.176923, 0.171429, 0.166667, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, },
-{0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.321429, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 1.083333, 1.076923, 1.071429, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.321429, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.271429, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.238095, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.219780, 0.214286, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.208333, 0.201923, 0.196429, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.202020, 0.194444, 0.188034, 0.182540, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.200000, 0.190909, 0.183333, 0.176923, 0.171429, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, },
-{0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 1.083333, 1.076923, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.219780, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.208333, 0.201923, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.202020, 0.194444, 0.188034, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.200000, 0.190909, 0.183333, 0.176923, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, },
-{0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 1.083333, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.208333, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.202020, 0.194444, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.200000, 0.190909, 0.183333, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, },
-{0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.202020, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.200000, 0.190909, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, },
-{0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.200000, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, },
-{0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, },
-{0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.202020, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, },
-{0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.200000, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.190909, 0.202020, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, },
-{0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.202020, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.190909, 0.200000, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.181818, 0.190909, 0.202020, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, },
-{0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 1.083333, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.208333, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.194444, 0.202020, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.183333, 0.190909, 0.200000, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.174242, 0.181818, 0.190909, 0.202020, 0.215909, 0.233766, 0.257576, 0.290909, },
-{0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 1.076923, 1.083333, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.219780, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.201923, 0.208333, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.188034, 0.194444, 0.202020, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.176923, 0.183333, 0.190909, 0.200000, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.167832, 0.174242, 0.181818, 0.190909, 0.202020, 0.215909, 0.233766, 0.257576, },
-{0.321429, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 1.071429, 1.076923, 1.083333, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.321429, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.271429, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.238095, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.214286, 0.219780, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.196429, 0.201923, 0.208333, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.182540, 0.188034, 0.194444, 0.202020, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.171429, 0.176923, 0.183333, 0.190909, 0.200000, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.162338, 0.167832, 0.174242, 0.181818, 0.190909, 0.202020, 0.215909, 0.233766, },
-{0.316667, 0.321429, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.400000, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.566667, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 1.066667, 1.071429, 1.076923, 1.083333, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 0.566667, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.400000, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.316667, 0.321429, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.266667, 0.271429, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.233333, 0.238095, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.209524, 0.214286, 0.219780, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.191667, 0.196429, 0.201923, 0.208333, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.177778, 0.182540, 0.188034, 0.194444, 0.202020, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.166667, 0.171429, 0.176923, 0.183333, 0.190909, 0.200000, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.157576, 0.162338, 0.167832, 0.174242, 0.181818, 0.190909, 0.202020, 0.215909, },
-{0.312500, 0.316667, 0.321429, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.395833, 0.400000, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.562500, 0.566667, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.062500, 1.066667, 1.071429, 1.076923, 1.083333, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 0.562500, 0.566667, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 0.395833, 0.400000, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.312500, 0.316667, 0.321429, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.262500, 0.266667, 0.271429, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.229167, 0.233333, 0.238095, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.205357, 0.209524, 0.214286, 0.219780, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.187500, 0.191667, 0.196429, 0.201923, 0.208333, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.173611, 0.177778, 0.182540, 0.188034, 0.194444, 0.202020, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.162500, 0.166667, 0.171429, 0.176923, 0.183333, 0.190909, 0.200000, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.153409, 0.157576, 0.162338, 0.167832, 0.174242, 0.181818, 0.190909, 0.202020, },
-{1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.271429, 0.266667, 0.262500, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.321429, 0.316667, 0.312500, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.400000, 0.395833, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 0.566667, 0.562500, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 1.083333, 1.076923, 1.071429, 1.066667, 1.062500, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 0.566667, 0.562500, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.400000, 0.395833, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.321429, 0.316667, 0.312500, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.271429, 0.266667, 0.262500, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.238095, 0.233333, 0.229167, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.219780, 0.214286, 0.209524, 0.205357, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.208333, 0.201923, 0.196429, 0.191667, 0.187500, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.202020, 0.194444, 0.188034, 0.182540, 0.177778, 0.173611, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, },
-{0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.271429, 0.266667, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.321429, 0.316667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.400000, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 0.566667, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 1.083333, 1.076923, 1.071429, 1.066667, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 0.566667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.400000, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.321429, 0.316667, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.271429, 0.266667, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.238095, 0.233333, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.219780, 0.214286, 0.209524, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.208333, 0.201923, 0.196429, 0.191667, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.202020, 0.194444, 0.188034, 0.182540, 0.177778, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, },
-{0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.271429, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.321429, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 1.083333, 1.076923, 1.071429, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.321429, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.271429, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.238095, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.219780, 0.214286, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.208333, 0.201923, 0.196429, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.202020, 0.194444, 0.188034, 0.182540, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, },
-{0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 1.083333, 1.076923, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.219780, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.208333, 0.201923, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.202020, 0.194444, 0.188034, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, },
-{0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 1.083333, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.208333, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.202020, 0.194444, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, },
-{0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.202020, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, },
-{0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, },
-{0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, },
-{0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, },
-{0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.200000, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, },
-{0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.202020, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.190909, 0.200000, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, },
-{0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 1.083333, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.208333, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.194444, 0.202020, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.183333, 0.190909, 0.200000, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, },
-{0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 1.076923, 1.083333, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.219780, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.201923, 0.208333, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.188034, 0.194444, 0.202020, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.176923, 0.183333, 0.190909, 0.200000, 0.211111, 0.225000, 0.242857, 0.266667, },
-{0.271429, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.321429, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 1.071429, 1.076923, 1.083333, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.321429, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.271429, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.238095, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.214286, 0.219780, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.196429, 0.201923, 0.208333, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.182540, 0.188034, 0.194444, 0.202020, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.171429, 0.176923, 0.183333, 0.190909, 0.200000, 0.211111, 0.225000, 0.242857, },
-{0.266667, 0.271429, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.316667, 0.321429, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.400000, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.566667, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 1.066667, 1.071429, 1.076923, 1.083333, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 0.566667, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.400000, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.316667, 0.321429, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.266667, 0.271429, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.233333, 0.238095, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.209524, 0.214286, 0.219780, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.191667, 0.196429, 0.201923, 0.208333, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.177778, 0.182540, 0.188034, 0.194444, 0.202020, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.166667, 0.171429, 0.176923, 0.183333, 0.190909, 0.200000, 0.211111, 0.225000, },
-{0.262500, 0.266667, 0.271429, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.312500, 0.316667, 0.321429, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.395833, 0.400000, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.562500, 0.566667, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.062500, 1.066667, 1.071429, 1.076923, 1.083333, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 0.562500, 0.566667, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 0.395833, 0.400000, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.312500, 0.316667, 0.321429, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.262500, 0.266667, 0.271429, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.229167, 0.233333, 0.238095, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.205357, 0.209524, 0.214286, 0.219780, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.187500, 0.191667, 0.196429, 0.201923, 0.208333, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.173611, 0.177778, 0.182540, 0.188034, 0.194444, 0.202020, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.162500, 0.166667, 0.171429, 0.176923, 0.183333, 0.190909, 0.200000, 0.211111, },
-{1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.238095, 0.233333, 0.229167, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.271429, 0.266667, 0.262500, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.321429, 0.316667, 0.312500, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.400000, 0.395833, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 0.566667, 0.562500, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 1.083333, 1.076923, 1.071429, 1.066667, 1.062500, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 0.566667, 0.562500, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.400000, 0.395833, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.321429, 0.316667, 0.312500, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.271429, 0.266667, 0.262500, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.238095, 0.233333, 0.229167, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.219780, 0.214286, 0.209524, 0.205357, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.208333, 0.201923, 0.196429, 0.191667, 0.187500, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, },
-{0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.238095, 0.233333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.271429, 0.266667, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.321429, 0.316667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.400000, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 0.566667, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 1.083333, 1.076923, 1.071429, 1.066667, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 0.566667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.400000, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.321429, 0.316667, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.271429, 0.266667, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.238095, 0.233333, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.219780, 0.214286, 0.209524, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.208333, 0.201923, 0.196429, 0.191667, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, },
-{0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.238095, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.271429, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.321429, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 1.083333, 1.076923, 1.071429, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.321429, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.271429, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.238095, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.219780, 0.214286, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.208333, 0.201923, 0.196429, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, },
-{0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 1.083333, 1.076923, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.219780, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.208333, 0.201923, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, },
-{0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 1.083333, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.208333, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, },
-{0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, },
-{0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, },
-{0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, },
-{0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, },
-{0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, },
-{0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.202020, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, },
-{0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 1.083333, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.208333, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.194444, 0.202020, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, },
-{0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 1.076923, 1.083333, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.219780, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.201923, 0.208333, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.188034, 0.194444, 0.202020, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, },
-{0.238095, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.271429, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.321429, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 1.071429, 1.076923, 1.083333, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.321429, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.271429, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.238095, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.214286, 0.219780, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.196429, 0.201923, 0.208333, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.182540, 0.188034, 0.194444, 0.202020, 0.211111, 0.222222, 0.236111, 0.253968, },
-{0.233333, 0.238095, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.266667, 0.271429, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.316667, 0.321429, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.400000, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.566667, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 1.066667, 1.071429, 1.076923, 1.083333, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 0.566667, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.400000, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.316667, 0.321429, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.266667, 0.271429, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.233333, 0.238095, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.209524, 0.214286, 0.219780, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.191667, 0.196429, 0.201923, 0.208333, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.177778, 0.182540, 0.188034, 0.194444, 0.202020, 0.211111, 0.222222, 0.236111, },
-{0.229167, 0.233333, 0.238095, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.262500, 0.266667, 0.271429, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.312500, 0.316667, 0.321429, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.395833, 0.400000, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.562500, 0.566667, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.062500, 1.066667, 1.071429, 1.076923, 1.083333, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 0.562500, 0.566667, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 0.395833, 0.400000, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.312500, 0.316667, 0.321429, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.262500, 0.266667, 0.271429, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.229167, 0.233333, 0.238095, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.205357, 0.209524, 0.214286, 0.219780, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.187500, 0.191667, 0.196429, 0.201923, 0.208333, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.173611, 0.177778, 0.182540, 0.188034, 0.194444, 0.202020, 0.211111, 0.222222, },
-{1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.219780, 0.214286, 0.209524, 0.205357, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.238095, 0.233333, 0.229167, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.271429, 0.266667, 0.262500, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.321429, 0.316667, 0.312500, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.400000, 0.395833, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 0.566667, 0.562500, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 1.083333, 1.076923, 1.071429, 1.066667, 1.062500, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 0.566667, 0.562500, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.400000, 0.395833, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.321429, 0.316667, 0.312500, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.271429, 0.266667, 0.262500, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.238095, 0.233333, 0.229167, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.219780, 0.214286, 0.209524, 0.205357, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, },
-{0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.219780, 0.214286, 0.209524, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.238095, 0.233333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.271429, 0.266667, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.321429, 0.316667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.400000, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 0.566667, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 1.083333, 1.076923, 1.071429, 1.066667, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 0.566667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.400000, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.321429, 0.316667, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.271429, 0.266667, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.238095, 0.233333, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.219780, 0.214286, 0.209524, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, },
-{0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.219780, 0.214286, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.238095, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.271429, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.321429, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 1.083333, 1.076923, 1.071429, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.321429, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.271429, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.238095, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.219780, 0.214286, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, },
-{0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.219780, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 1.083333, 1.076923, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.219780, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, },
-{0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 1.083333, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, },
-{0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, },
-{0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, },
-{0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, },
-{0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, },
-{0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, },
-{0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, },
-{0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 1.083333, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.208333, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, },
-{0.219780, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 1.076923, 1.083333, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.219780, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.201923, 0.208333, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, },
-{0.214286, 0.219780, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.238095, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.271429, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.321429, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 1.071429, 1.076923, 1.083333, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.321429, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.271429, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.238095, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.214286, 0.219780, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.196429, 0.201923, 0.208333, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, },
-{0.209524, 0.214286, 0.219780, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.233333, 0.238095, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.266667, 0.271429, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.316667, 0.321429, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.400000, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.566667, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 1.066667, 1.071429, 1.076923, 1.083333, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 0.566667, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.400000, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.316667, 0.321429, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.266667, 0.271429, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.233333, 0.238095, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.209524, 0.214286, 0.219780, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.191667, 0.196429, 0.201923, 0.208333, 0.215909, 0.225000, 0.236111, 0.250000, },
-{0.205357, 0.209524, 0.214286, 0.219780, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.229167, 0.233333, 0.238095, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.262500, 0.266667, 0.271429, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.312500, 0.316667, 0.321429, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.395833, 0.400000, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.562500, 0.566667, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.062500, 1.066667, 1.071429, 1.076923, 1.083333, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 0.562500, 0.566667, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 0.395833, 0.400000, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.312500, 0.316667, 0.321429, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.262500, 0.266667, 0.271429, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.229167, 0.233333, 0.238095, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.205357, 0.209524, 0.214286, 0.219780, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.187500, 0.191667, 0.196429, 0.201923, 0.208333, 0.215909, 0.225000, 0.236111, },
-{1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.208333, 0.201923, 0.196429, 0.191667, 0.187500, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.219780, 0.214286, 0.209524, 0.205357, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.238095, 0.233333, 0.229167, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.271429, 0.266667, 0.262500, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.321429, 0.316667, 0.312500, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.400000, 0.395833, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 0.566667, 0.562500, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 1.083333, 1.076923, 1.071429, 1.066667, 1.062500, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 0.566667, 0.562500, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.400000, 0.395833, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.321429, 0.316667, 0.312500, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.271429, 0.266667, 0.262500, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.238095, 0.233333, 0.229167, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, },
-{0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.208333, 0.201923, 0.196429, 0.191667, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.219780, 0.214286, 0.209524, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.238095, 0.233333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.271429, 0.266667, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.321429, 0.316667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.400000, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 0.566667, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 1.083333, 1.076923, 1.071429, 1.066667, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 0.566667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.400000, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.321429, 0.316667, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.271429, 0.266667, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.238095, 0.233333, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, },
-{0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.208333, 0.201923, 0.196429, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.219780, 0.214286, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.238095, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.271429, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.321429, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 1.083333, 1.076923, 1.071429, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.321429, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.271429, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.238095, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, },
-{0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.208333, 0.201923, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.219780, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 1.083333, 1.076923, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, },
-{0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.208333, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 1.083333, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, },
-{0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, },
-{0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, },
-{0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, },
-{0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, },
-{0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, },
-{0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, },
-{0.208333, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 1.083333, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, },
-{0.201923, 0.208333, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.219780, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 1.076923, 1.083333, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.219780, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, },
-{0.196429, 0.201923, 0.208333, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.214286, 0.219780, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.238095, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.271429, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.321429, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 1.071429, 1.076923, 1.083333, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.321429, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.271429, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.238095, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.214286, 0.219780, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, },
-{0.191667, 0.196429, 0.201923, 0.208333, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.209524, 0.214286, 0.219780, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.233333, 0.238095, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.266667, 0.271429, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.316667, 0.321429, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.400000, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.566667, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 1.066667, 1.071429, 1.076923, 1.083333, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 0.566667, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.400000, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.316667, 0.321429, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.266667, 0.271429, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.233333, 0.238095, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.209524, 0.214286, 0.219780, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, },
-{0.187500, 0.191667, 0.196429, 0.201923, 0.208333, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.205357, 0.209524, 0.214286, 0.219780, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.229167, 0.233333, 0.238095, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.262500, 0.266667, 0.271429, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.312500, 0.316667, 0.321429, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.395833, 0.400000, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.562500, 0.566667, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.062500, 1.066667, 1.071429, 1.076923, 1.083333, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 0.562500, 0.566667, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 0.395833, 0.400000, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.312500, 0.316667, 0.321429, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.262500, 0.266667, 0.271429, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.229167, 0.233333, 0.238095, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.205357, 0.209524, 0.214286, 0.219780, 0.226190, 0.233766, 0.242857, 0.253968, },
-{1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.202020, 0.194444, 0.188034, 0.182540, 0.177778, 0.173611, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.208333, 0.201923, 0.196429, 0.191667, 0.187500, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.219780, 0.214286, 0.209524, 0.205357, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.238095, 0.233333, 0.229167, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.271429, 0.266667, 0.262500, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.321429, 0.316667, 0.312500, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.400000, 0.395833, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 0.566667, 0.562500, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 1.083333, 1.076923, 1.071429, 1.066667, 1.062500, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 0.566667, 0.562500, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.400000, 0.395833, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.321429, 0.316667, 0.312500, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.271429, 0.266667, 0.262500, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, },
-{0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.202020, 0.194444, 0.188034, 0.182540, 0.177778, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.208333, 0.201923, 0.196429, 0.191667, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.219780, 0.214286, 0.209524, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.238095, 0.233333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.271429, 0.266667, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.321429, 0.316667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.400000, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 0.566667, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 1.083333, 1.076923, 1.071429, 1.066667, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 0.566667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.400000, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.321429, 0.316667, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.271429, 0.266667, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, },
-{0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.202020, 0.194444, 0.188034, 0.182540, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.208333, 0.201923, 0.196429, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.219780, 0.214286, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.238095, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.271429, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.321429, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 1.083333, 1.076923, 1.071429, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.321429, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.271429, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, },
-{0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.202020, 0.194444, 0.188034, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.208333, 0.201923, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.219780, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 1.083333, 1.076923, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, },
-{0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.202020, 0.194444, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.208333, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 1.083333, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, },
-{0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.202020, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, },
-{0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, },
-{0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, },
-{0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, },
-{0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, },
-{0.202020, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, },
-{0.194444, 0.202020, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.208333, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 1.083333, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, },
-{0.188034, 0.194444, 0.202020, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.201923, 0.208333, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.219780, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 1.076923, 1.083333, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, },
-{0.182540, 0.188034, 0.194444, 0.202020, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.196429, 0.201923, 0.208333, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.214286, 0.219780, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.238095, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.271429, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.321429, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 1.071429, 1.076923, 1.083333, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.321429, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.271429, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.238095, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, },
-{0.177778, 0.182540, 0.188034, 0.194444, 0.202020, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.191667, 0.196429, 0.201923, 0.208333, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.209524, 0.214286, 0.219780, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.233333, 0.238095, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.266667, 0.271429, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.316667, 0.321429, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.400000, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.566667, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 1.066667, 1.071429, 1.076923, 1.083333, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 0.566667, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.400000, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.316667, 0.321429, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.266667, 0.271429, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.233333, 0.238095, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, },
-{0.173611, 0.177778, 0.182540, 0.188034, 0.194444, 0.202020, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.187500, 0.191667, 0.196429, 0.201923, 0.208333, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.205357, 0.209524, 0.214286, 0.219780, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.229167, 0.233333, 0.238095, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.262500, 0.266667, 0.271429, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.312500, 0.316667, 0.321429, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.395833, 0.400000, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.562500, 0.566667, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.062500, 1.066667, 1.071429, 1.076923, 1.083333, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 0.562500, 0.566667, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 0.395833, 0.400000, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.312500, 0.316667, 0.321429, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.262500, 0.266667, 0.271429, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.229167, 0.233333, 0.238095, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, },
-{1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.200000, 0.190909, 0.183333, 0.176923, 0.171429, 0.166667, 0.162500, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.202020, 0.194444, 0.188034, 0.182540, 0.177778, 0.173611, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.208333, 0.201923, 0.196429, 0.191667, 0.187500, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.219780, 0.214286, 0.209524, 0.205357, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.238095, 0.233333, 0.229167, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.271429, 0.266667, 0.262500, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.321429, 0.316667, 0.312500, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.400000, 0.395833, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 0.566667, 0.562500, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 1.083333, 1.076923, 1.071429, 1.066667, 1.062500, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 0.566667, 0.562500, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.400000, 0.395833, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.321429, 0.316667, 0.312500, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, },
-{0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.200000, 0.190909, 0.183333, 0.176923, 0.171429, 0.166667, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.202020, 0.194444, 0.188034, 0.182540, 0.177778, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.208333, 0.201923, 0.196429, 0.191667, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.219780, 0.214286, 0.209524, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.238095, 0.233333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.271429, 0.266667, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.321429, 0.316667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.400000, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 0.566667, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 1.083333, 1.076923, 1.071429, 1.066667, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 0.566667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.400000, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.321429, 0.316667, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, },
-{0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.200000, 0.190909, 0.183333, 0.176923, 0.171429, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.202020, 0.194444, 0.188034, 0.182540, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.208333, 0.201923, 0.196429, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.219780, 0.214286, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.238095, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.271429, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.321429, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 1.083333, 1.076923, 1.071429, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.321429, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, },
-{0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.200000, 0.190909, 0.183333, 0.176923, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.202020, 0.194444, 0.188034, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.208333, 0.201923, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.219780, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 1.083333, 1.076923, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, },
-{0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.200000, 0.190909, 0.183333, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.202020, 0.194444, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.208333, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 1.083333, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, },
-{0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.200000, 0.190909, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.202020, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, },
-{0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.200000, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, },
-{0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, },
-{0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, },
-{0.200000, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, },
-{0.190909, 0.200000, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.202020, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, },
-{0.183333, 0.190909, 0.200000, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.194444, 0.202020, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.208333, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 1.083333, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, },
-{0.176923, 0.183333, 0.190909, 0.200000, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.188034, 0.194444, 0.202020, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.201923, 0.208333, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.219780, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 1.076923, 1.083333, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, },
-{0.171429, 0.176923, 0.183333, 0.190909, 0.200000, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.182540, 0.188034, 0.194444, 0.202020, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.196429, 0.201923, 0.208333, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.214286, 0.219780, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.238095, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.271429, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.321429, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 1.071429, 1.076923, 1.083333, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.321429, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.271429, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, },
-{0.166667, 0.171429, 0.176923, 0.183333, 0.190909, 0.200000, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.177778, 0.182540, 0.188034, 0.194444, 0.202020, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.191667, 0.196429, 0.201923, 0.208333, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.209524, 0.214286, 0.219780, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.233333, 0.238095, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.266667, 0.271429, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.316667, 0.321429, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.400000, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.566667, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 1.066667, 1.071429, 1.076923, 1.083333, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 0.566667, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.400000, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.316667, 0.321429, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.266667, 0.271429, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, },
-{0.162500, 0.166667, 0.171429, 0.176923, 0.183333, 0.190909, 0.200000, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.173611, 0.177778, 0.182540, 0.188034, 0.194444, 0.202020, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.187500, 0.191667, 0.196429, 0.201923, 0.208333, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.205357, 0.209524, 0.214286, 0.219780, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.229167, 0.233333, 0.238095, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.262500, 0.266667, 0.271429, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.312500, 0.316667, 0.321429, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.395833, 0.400000, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.562500, 0.566667, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.062500, 1.066667, 1.071429, 1.076923, 1.083333, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 0.562500, 0.566667, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 0.395833, 0.400000, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.312500, 0.316667, 0.321429, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.262500, 0.266667, 0.271429, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, },
-{1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.215909, 0.202020, 0.190909, 0.181818, 0.174242, 0.167832, 0.162338, 0.157576, 0.153409, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.200000, 0.190909, 0.183333, 0.176923, 0.171429, 0.166667, 0.162500, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.202020, 0.194444, 0.188034, 0.182540, 0.177778, 0.173611, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.208333, 0.201923, 0.196429, 0.191667, 0.187500, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.219780, 0.214286, 0.209524, 0.205357, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.238095, 0.233333, 0.229167, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.271429, 0.266667, 0.262500, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.321429, 0.316667, 0.312500, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.400000, 0.395833, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 0.566667, 0.562500, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 1.083333, 1.076923, 1.071429, 1.066667, 1.062500, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 0.566667, 0.562500, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.400000, 0.395833, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, },
-{0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.215909, 0.202020, 0.190909, 0.181818, 0.174242, 0.167832, 0.162338, 0.157576, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.200000, 0.190909, 0.183333, 0.176923, 0.171429, 0.166667, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.202020, 0.194444, 0.188034, 0.182540, 0.177778, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.208333, 0.201923, 0.196429, 0.191667, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.219780, 0.214286, 0.209524, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.238095, 0.233333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.271429, 0.266667, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.321429, 0.316667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.400000, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 0.566667, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 1.083333, 1.076923, 1.071429, 1.066667, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 0.566667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.400000, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, },
-{0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.215909, 0.202020, 0.190909, 0.181818, 0.174242, 0.167832, 0.162338, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.200000, 0.190909, 0.183333, 0.176923, 0.171429, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.202020, 0.194444, 0.188034, 0.182540, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.208333, 0.201923, 0.196429, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.219780, 0.214286, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.238095, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.271429, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.321429, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 1.083333, 1.076923, 1.071429, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, },
-{0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.215909, 0.202020, 0.190909, 0.181818, 0.174242, 0.167832, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.200000, 0.190909, 0.183333, 0.176923, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.202020, 0.194444, 0.188034, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.208333, 0.201923, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.219780, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 1.083333, 1.076923, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, },
-{0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.215909, 0.202020, 0.190909, 0.181818, 0.174242, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.200000, 0.190909, 0.183333, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.202020, 0.194444, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.208333, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 1.083333, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, },
-{0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.215909, 0.202020, 0.190909, 0.181818, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.200000, 0.190909, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.202020, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, },
-{0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.215909, 0.202020, 0.190909, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.200000, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, },
-{0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.215909, 0.202020, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, },
-{0.202020, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.215909, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, },
-{0.190909, 0.202020, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.200000, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, },
-{0.181818, 0.190909, 0.202020, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.190909, 0.200000, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.202020, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, },
-{0.174242, 0.181818, 0.190909, 0.202020, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.183333, 0.190909, 0.200000, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.194444, 0.202020, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.208333, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 1.083333, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, },
-{0.167832, 0.174242, 0.181818, 0.190909, 0.202020, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.176923, 0.183333, 0.190909, 0.200000, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.188034, 0.194444, 0.202020, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.201923, 0.208333, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.219780, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 1.076923, 1.083333, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, },
-{0.162338, 0.167832, 0.174242, 0.181818, 0.190909, 0.202020, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.171429, 0.176923, 0.183333, 0.190909, 0.200000, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.182540, 0.188034, 0.194444, 0.202020, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.196429, 0.201923, 0.208333, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.214286, 0.219780, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.238095, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.271429, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.321429, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 1.071429, 1.076923, 1.083333, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.321429, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, },
-{0.157576, 0.162338, 0.167832, 0.174242, 0.181818, 0.190909, 0.202020, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.166667, 0.171429, 0.176923, 0.183333, 0.190909, 0.200000, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.177778, 0.182540, 0.188034, 0.194444, 0.202020, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.191667, 0.196429, 0.201923, 0.208333, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.209524, 0.214286, 0.219780, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.233333, 0.238095, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.266667, 0.271429, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.316667, 0.321429, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.400000, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.566667, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 1.066667, 1.071429, 1.076923, 1.083333, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 0.566667, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.400000, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.316667, 0.321429, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, },
-{0.153409, 0.157576, 0.162338, 0.167832, 0.174242, 0.181818, 0.190909, 0.202020, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.162500, 0.166667, 0.171429, 0.176923, 0.183333, 0.190909, 0.200000, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.173611, 0.177778, 0.182540, 0.188034, 0.194444, 0.202020, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.187500, 0.191667, 0.196429, 0.201923, 0.208333, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.205357, 0.209524, 0.214286, 0.219780, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.229167, 0.233333, 0.238095, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.262500, 0.266667, 0.271429, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.312500, 0.316667, 0.321429, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.395833, 0.400000, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.562500, 0.566667, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.062500, 1.066667, 1.071429, 1.076923, 1.083333, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 0.562500, 0.566667, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 0.395833, 0.400000, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.312500, 0.316667, 0.321429, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, },
-{1.083333, 0.583333, 0.416667, 0.333333, 0.283333, 0.250000, 0.226190, 0.208333, 0.194444, 0.183333, 0.174242, 0.166667, 0.160256, 0.154762, 0.150000, 0.145833, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.215909, 0.202020, 0.190909, 0.181818, 0.174242, 0.167832, 0.162338, 0.157576, 0.153409, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.200000, 0.190909, 0.183333, 0.176923, 0.171429, 0.166667, 0.162500, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.202020, 0.194444, 0.188034, 0.182540, 0.177778, 0.173611, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.208333, 0.201923, 0.196429, 0.191667, 0.187500, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.219780, 0.214286, 0.209524, 0.205357, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.238095, 0.233333, 0.229167, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.271429, 0.266667, 0.262500, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.321429, 0.316667, 0.312500, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.400000, 0.395833, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 0.566667, 0.562500, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 1.083333, 1.076923, 1.071429, 1.066667, 1.062500, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 0.566667, 0.562500, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, },
-{0.583333, 1.083333, 0.583333, 0.416667, 0.333333, 0.283333, 0.250000, 0.226190, 0.208333, 0.194444, 0.183333, 0.174242, 0.166667, 0.160256, 0.154762, 0.150000, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.215909, 0.202020, 0.190909, 0.181818, 0.174242, 0.167832, 0.162338, 0.157576, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.200000, 0.190909, 0.183333, 0.176923, 0.171429, 0.166667, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.202020, 0.194444, 0.188034, 0.182540, 0.177778, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.208333, 0.201923, 0.196429, 0.191667, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.219780, 0.214286, 0.209524, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.238095, 0.233333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.271429, 0.266667, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.321429, 0.316667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.400000, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 0.566667, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 1.083333, 1.076923, 1.071429, 1.066667, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 0.566667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, },
-{0.416667, 0.583333, 1.083333, 0.583333, 0.416667, 0.333333, 0.283333, 0.250000, 0.226190, 0.208333, 0.194444, 0.183333, 0.174242, 0.166667, 0.160256, 0.154762, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.215909, 0.202020, 0.190909, 0.181818, 0.174242, 0.167832, 0.162338, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.200000, 0.190909, 0.183333, 0.176923, 0.171429, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.202020, 0.194444, 0.188034, 0.182540, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.208333, 0.201923, 0.196429, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.219780, 0.214286, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.238095, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.271429, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.321429, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 1.083333, 1.076923, 1.071429, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, },
-{0.333333, 0.416667, 0.583333, 1.083333, 0.583333, 0.416667, 0.333333, 0.283333, 0.250000, 0.226190, 0.208333, 0.194444, 0.183333, 0.174242, 0.166667, 0.160256, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.215909, 0.202020, 0.190909, 0.181818, 0.174242, 0.167832, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.200000, 0.190909, 0.183333, 0.176923, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.202020, 0.194444, 0.188034, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.208333, 0.201923, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.219780, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 1.083333, 1.076923, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, },
-{0.283333, 0.333333, 0.416667, 0.583333, 1.083333, 0.583333, 0.416667, 0.333333, 0.283333, 0.250000, 0.226190, 0.208333, 0.194444, 0.183333, 0.174242, 0.166667, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.215909, 0.202020, 0.190909, 0.181818, 0.174242, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.200000, 0.190909, 0.183333, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.202020, 0.194444, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.208333, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 1.083333, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, },
-{0.250000, 0.283333, 0.333333, 0.416667, 0.583333, 1.083333, 0.583333, 0.416667, 0.333333, 0.283333, 0.250000, 0.226190, 0.208333, 0.194444, 0.183333, 0.174242, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.215909, 0.202020, 0.190909, 0.181818, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.200000, 0.190909, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.202020, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, },
-{0.226190, 0.250000, 0.283333, 0.333333, 0.416667, 0.583333, 1.083333, 0.583333, 0.416667, 0.333333, 0.283333, 0.250000, 0.226190, 0.208333, 0.194444, 0.183333, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.215909, 0.202020, 0.190909, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.200000, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, },
-{0.208333, 0.226190, 0.250000, 0.283333, 0.333333, 0.416667, 0.583333, 1.083333, 0.583333, 0.416667, 0.333333, 0.283333, 0.250000, 0.226190, 0.208333, 0.194444, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.215909, 0.202020, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, },
-{0.194444, 0.208333, 0.226190, 0.250000, 0.283333, 0.333333, 0.416667, 0.583333, 1.083333, 0.583333, 0.416667, 0.333333, 0.283333, 0.250000, 0.226190, 0.208333, 0.202020, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.215909, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, },
-{0.183333, 0.194444, 0.208333, 0.226190, 0.250000, 0.283333, 0.333333, 0.416667, 0.583333, 1.083333, 0.583333, 0.416667, 0.333333, 0.283333, 0.250000, 0.226190, 0.190909, 0.202020, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.200000, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, },
-{0.174242, 0.183333, 0.194444, 0.208333, 0.226190, 0.250000, 0.283333, 0.333333, 0.416667, 0.583333, 1.083333, 0.583333, 0.416667, 0.333333, 0.283333, 0.250000, 0.181818, 0.190909, 0.202020, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.190909, 0.200000, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.202020, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, },
-{0.166667, 0.174242, 0.183333, 0.194444, 0.208333, 0.226190, 0.250000, 0.283333, 0.333333, 0.416667, 0.583333, 1.083333, 0.583333, 0.416667, 0.333333, 0.283333, 0.174242, 0.181818, 0.190909, 0.202020, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.183333, 0.190909, 0.200000, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.194444, 0.202020, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.208333, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 1.083333, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, },
-{0.160256, 0.166667, 0.174242, 0.183333, 0.194444, 0.208333, 0.226190, 0.250000, 0.283333, 0.333333, 0.416667, 0.583333, 1.083333, 0.583333, 0.416667, 0.333333, 0.167832, 0.174242, 0.181818, 0.190909, 0.202020, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.176923, 0.183333, 0.190909, 0.200000, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.188034, 0.194444, 0.202020, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.201923, 0.208333, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.219780, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 1.076923, 1.083333, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, },
-{0.154762, 0.160256, 0.166667, 0.174242, 0.183333, 0.194444, 0.208333, 0.226190, 0.250000, 0.283333, 0.333333, 0.416667, 0.583333, 1.083333, 0.583333, 0.416667, 0.162338, 0.167832, 0.174242, 0.181818, 0.190909, 0.202020, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.171429, 0.176923, 0.183333, 0.190909, 0.200000, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.182540, 0.188034, 0.194444, 0.202020, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.196429, 0.201923, 0.208333, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.214286, 0.219780, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.238095, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.271429, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.321429, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 1.071429, 1.076923, 1.083333, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, },
-{0.150000, 0.154762, 0.160256, 0.166667, 0.174242, 0.183333, 0.194444, 0.208333, 0.226190, 0.250000, 0.283333, 0.333333, 0.416667, 0.583333, 1.083333, 0.583333, 0.157576, 0.162338, 0.167832, 0.174242, 0.181818, 0.190909, 0.202020, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.166667, 0.171429, 0.176923, 0.183333, 0.190909, 0.200000, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.177778, 0.182540, 0.188034, 0.194444, 0.202020, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.191667, 0.196429, 0.201923, 0.208333, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.209524, 0.214286, 0.219780, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.233333, 0.238095, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.266667, 0.271429, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.316667, 0.321429, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.400000, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.566667, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 1.066667, 1.071429, 1.076923, 1.083333, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 0.566667, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.400000, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, },
-{0.145833, 0.150000, 0.154762, 0.160256, 0.166667, 0.174242, 0.183333, 0.194444, 0.208333, 0.226190, 0.250000, 0.283333, 0.333333, 0.416667, 0.583333, 1.083333, 0.153409, 0.157576, 0.162338, 0.167832, 0.174242, 0.181818, 0.190909, 0.202020, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.162500, 0.166667, 0.171429, 0.176923, 0.183333, 0.190909, 0.200000, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.173611, 0.177778, 0.182540, 0.188034, 0.194444, 0.202020, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.187500, 0.191667, 0.196429, 0.201923, 0.208333, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.205357, 0.209524, 0.214286, 0.219780, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.229167, 0.233333, 0.238095, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.262500, 0.266667, 0.271429, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.312500, 0.316667, 0.321429, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.395833, 0.400000, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.562500, 0.566667, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.062500, 1.066667, 1.071429, 1.076923, 1.083333, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 0.562500, 0.566667, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 0.395833, 0.400000, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, },
-{1.076923, 0.576923, 0.410256, 0.326923, 0.276923, 0.243590, 0.219780, 0.201923, 0.188034, 0.176923, 0.167832, 0.160256, 0.153846, 0.148352, 0.143590, 0.139423, 1.083333, 0.583333, 0.416667, 0.333333, 0.283333, 0.250000, 0.226190, 0.208333, 0.194444, 0.183333, 0.174242, 0.166667, 0.160256, 0.154762, 0.150000, 0.145833, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.215909, 0.202020, 0.190909, 0.181818, 0.174242, 0.167832, 0.162338, 0.157576, 0.153409, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.200000, 0.190909, 0.183333, 0.176923, 0.171429, 0.166667, 0.162500, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.202020, 0.194444, 0.188034, 0.182540, 0.177778, 0.173611, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.208333, 0.201923, 0.196429, 0.191667, 0.187500, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.219780, 0.214286, 0.209524, 0.205357, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.238095, 0.233333, 0.229167, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.271429, 0.266667, 0.262500, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.321429, 0.316667, 0.312500, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.400000, 0.395833, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 0.566667, 0.562500, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 1.083333, 1.076923, 1.071429, 1.066667, 1.062500, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, },
-{0.576923, 1.076923, 0.576923, 0.410256, 0.326923, 0.276923, 0.243590, 0.219780, 0.201923, 0.188034, 0.176923, 0.167832, 0.160256, 0.153846, 0.148352, 0.143590, 0.583333, 1.083333, 0.583333, 0.416667, 0.333333, 0.283333, 0.250000, 0.226190, 0.208333, 0.194444, 0.183333, 0.174242, 0.166667, 0.160256, 0.154762, 0.150000, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.215909, 0.202020, 0.190909, 0.181818, 0.174242, 0.167832, 0.162338, 0.157576, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.200000, 0.190909, 0.183333, 0.176923, 0.171429, 0.166667, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.202020, 0.194444, 0.188034, 0.182540, 0.177778, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.208333, 0.201923, 0.196429, 0.191667, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.219780, 0.214286, 0.209524, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.238095, 0.233333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.271429, 0.266667, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.321429, 0.316667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.400000, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 0.566667, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 1.083333, 1.076923, 1.071429, 1.066667, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, },
-{0.410256, 0.576923, 1.076923, 0.576923, 0.410256, 0.326923, 0.276923, 0.243590, 0.219780, 0.201923, 0.188034, 0.176923, 0.167832, 0.160256, 0.153846, 0.148352, 0.416667, 0.583333, 1.083333, 0.583333, 0.416667, 0.333333, 0.283333, 0.250000, 0.226190, 0.208333, 0.194444, 0.183333, 0.174242, 0.166667, 0.160256, 0.154762, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.215909, 0.202020, 0.190909, 0.181818, 0.174242, 0.167832, 0.162338, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.200000, 0.190909, 0.183333, 0.176923, 0.171429, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.202020, 0.194444, 0.188034, 0.182540, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.208333, 0.201923, 0.196429, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.219780, 0.214286, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.238095, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.271429, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.321429, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 1.083333, 1.076923, 1.071429, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, },
-{0.326923, 0.410256, 0.576923, 1.076923, 0.576923, 0.410256, 0.326923, 0.276923, 0.243590, 0.219780, 0.201923, 0.188034, 0.176923, 0.167832, 0.160256, 0.153846, 0.333333, 0.416667, 0.583333, 1.083333, 0.583333, 0.416667, 0.333333, 0.283333, 0.250000, 0.226190, 0.208333, 0.194444, 0.183333, 0.174242, 0.166667, 0.160256, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.215909, 0.202020, 0.190909, 0.181818, 0.174242, 0.167832, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.200000, 0.190909, 0.183333, 0.176923, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.202020, 0.194444, 0.188034, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.208333, 0.201923, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.219780, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 1.083333, 1.076923, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, },
-{0.276923, 0.326923, 0.410256, 0.576923, 1.076923, 0.576923, 0.410256, 0.326923, 0.276923, 0.243590, 0.219780, 0.201923, 0.188034, 0.176923, 0.167832, 0.160256, 0.283333, 0.333333, 0.416667, 0.583333, 1.083333, 0.583333, 0.416667, 0.333333, 0.283333, 0.250000, 0.226190, 0.208333, 0.194444, 0.183333, 0.174242, 0.166667, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.215909, 0.202020, 0.190909, 0.181818, 0.174242, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.200000, 0.190909, 0.183333, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.202020, 0.194444, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.208333, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 1.083333, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, },
-{0.243590, 0.276923, 0.326923, 0.410256, 0.576923, 1.076923, 0.576923, 0.410256, 0.326923, 0.276923, 0.243590, 0.219780, 0.201923, 0.188034, 0.176923, 0.167832, 0.250000, 0.283333, 0.333333, 0.416667, 0.583333, 1.083333, 0.583333, 0.416667, 0.333333, 0.283333, 0.250000, 0.226190, 0.208333, 0.194444, 0.183333, 0.174242, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.215909, 0.202020, 0.190909, 0.181818, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.200000, 0.190909, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.202020, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 1.090909, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, },
-{0.219780, 0.243590, 0.276923, 0.326923, 0.410256, 0.576923, 1.076923, 0.576923, 0.410256, 0.326923, 0.276923, 0.243590, 0.219780, 0.201923, 0.188034, 0.176923, 0.226190, 0.250000, 0.283333, 0.333333, 0.416667, 0.583333, 1.083333, 0.583333, 0.416667, 0.333333, 0.283333, 0.250000, 0.226190, 0.208333, 0.194444, 0.183333, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.215909, 0.202020, 0.190909, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.200000, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 1.100000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, },
-{0.201923, 0.219780, 0.243590, 0.276923, 0.326923, 0.410256, 0.576923, 1.076923, 0.576923, 0.410256, 0.326923, 0.276923, 0.243590, 0.219780, 0.201923, 0.188034, 0.208333, 0.226190, 0.250000, 0.283333, 0.333333, 0.416667, 0.583333, 1.083333, 0.583333, 0.416667, 0.333333, 0.283333, 0.250000, 0.226190, 0.208333, 0.194444, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.215909, 0.202020, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 1.111111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, },
-{0.188034, 0.201923, 0.219780, 0.243590, 0.276923, 0.326923, 0.410256, 0.576923, 1.076923, 0.576923, 0.410256, 0.326923, 0.276923, 0.243590, 0.219780, 0.201923, 0.194444, 0.208333, 0.226190, 0.250000, 0.283333, 0.333333, 0.416667, 0.583333, 1.083333, 0.583333, 0.416667, 0.333333, 0.283333, 0.250000, 0.226190, 0.208333, 0.202020, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.215909, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, },
-{0.176923, 0.188034, 0.201923, 0.219780, 0.243590, 0.276923, 0.326923, 0.410256, 0.576923, 1.076923, 0.576923, 0.410256, 0.326923, 0.276923, 0.243590, 0.219780, 0.183333, 0.194444, 0.208333, 0.226190, 0.250000, 0.283333, 0.333333, 0.416667, 0.583333, 1.083333, 0.583333, 0.416667, 0.333333, 0.283333, 0.250000, 0.226190, 0.190909, 0.202020, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.200000, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, },
-{0.167832, 0.176923, 0.188034, 0.201923, 0.219780, 0.243590, 0.276923, 0.326923, 0.410256, 0.576923, 1.076923, 0.576923, 0.410256, 0.326923, 0.276923, 0.243590, 0.174242, 0.183333, 0.194444, 0.208333, 0.226190, 0.250000, 0.283333, 0.333333, 0.416667, 0.583333, 1.083333, 0.583333, 0.416667, 0.333333, 0.283333, 0.250000, 0.181818, 0.190909, 0.202020, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.190909, 0.200000, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.202020, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, },
-{0.160256, 0.167832, 0.176923, 0.188034, 0.201923, 0.219780, 0.243590, 0.276923, 0.326923, 0.410256, 0.576923, 1.076923, 0.576923, 0.410256, 0.326923, 0.276923, 0.166667, 0.174242, 0.183333, 0.194444, 0.208333, 0.226190, 0.250000, 0.283333, 0.333333, 0.416667, 0.583333, 1.083333, 0.583333, 0.416667, 0.333333, 0.283333, 0.174242, 0.181818, 0.190909, 0.202020, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.183333, 0.190909, 0.200000, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.194444, 0.202020, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.208333, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 1.083333, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, },
-{0.153846, 0.160256, 0.167832, 0.176923, 0.188034, 0.201923, 0.219780, 0.243590, 0.276923, 0.326923, 0.410256, 0.576923, 1.076923, 0.576923, 0.410256, 0.326923, 0.160256, 0.166667, 0.174242, 0.183333, 0.194444, 0.208333, 0.226190, 0.250000, 0.283333, 0.333333, 0.416667, 0.583333, 1.083333, 0.583333, 0.416667, 0.333333, 0.167832, 0.174242, 0.181818, 0.190909, 0.202020, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.176923, 0.183333, 0.190909, 0.200000, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.188034, 0.194444, 0.202020, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.201923, 0.208333, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.219780, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 1.076923, 1.083333, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, },
-{0.148352, 0.153846, 0.160256, 0.167832, 0.176923, 0.188034, 0.201923, 0.219780, 0.243590, 0.276923, 0.326923, 0.410256, 0.576923, 1.076923, 0.576923, 0.410256, 0.154762, 0.160256, 0.166667, 0.174242, 0.183333, 0.194444, 0.208333, 0.226190, 0.250000, 0.283333, 0.333333, 0.416667, 0.583333, 1.083333, 0.583333, 0.416667, 0.162338, 0.167832, 0.174242, 0.181818, 0.190909, 0.202020, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.171429, 0.176923, 0.183333, 0.190909, 0.200000, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.182540, 0.188034, 0.194444, 0.202020, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.196429, 0.201923, 0.208333, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.214286, 0.219780, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.238095, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.271429, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.321429, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 1.071429, 1.076923, 1.083333, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, },
-{0.143590, 0.148352, 0.153846, 0.160256, 0.167832, 0.176923, 0.188034, 0.201923, 0.219780, 0.243590, 0.276923, 0.326923, 0.410256, 0.576923, 1.076923, 0.576923, 0.150000, 0.154762, 0.160256, 0.166667, 0.174242, 0.183333, 0.194444, 0.208333, 0.226190, 0.250000, 0.283333, 0.333333, 0.416667, 0.583333, 1.083333, 0.583333, 0.157576, 0.162338, 0.167832, 0.174242, 0.181818, 0.190909, 0.202020, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.166667, 0.171429, 0.176923, 0.183333, 0.190909, 0.200000, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.177778, 0.182540, 0.188034, 0.194444, 0.202020, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.191667, 0.196429, 0.201923, 0.208333, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.209524, 0.214286, 0.219780, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.233333, 0.238095, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.266667, 0.271429, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.316667, 0.321429, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.400000, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.566667, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 1.066667, 1.071429, 1.076923, 1.083333, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 0.566667, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, },
-{0.139423, 0.143590, 0.148352, 0.153846, 0.160256, 0.167832, 0.176923, 0.188034, 0.201923, 0.219780, 0.243590, 0.276923, 0.326923, 0.410256, 0.576923, 1.076923, 0.145833, 0.150000, 0.154762, 0.160256, 0.166667, 0.174242, 0.183333, 0.194444, 0.208333, 0.226190, 0.250000, 0.283333, 0.333333, 0.416667, 0.583333, 1.083333, 0.153409, 0.157576, 0.162338, 0.167832, 0.174242, 0.181818, 0.190909, 0.202020, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.162500, 0.166667, 0.171429, 0.176923, 0.183333, 0.190909, 0.200000, 0.211111, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.173611, 0.177778, 0.182540, 0.188034, 0.194444, 0.202020, 0.211111, 0.222222, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.187500, 0.191667, 0.196429, 0.201923, 0.208333, 0.215909, 0.225000, 0.236111, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.205357, 0.209524, 0.214286, 0.219780, 0.226190, 0.233766, 0.242857, 0.253968, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.229167, 0.233333, 0.238095, 0.243590, 0.250000, 0.257576, 0.266667, 0.277778, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.262500, 0.266667, 0.271429, 0.276923, 0.283333, 0.290909, 0.300000, 0.311111, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.312500, 0.316667, 0.321429, 0.326923, 0.333333, 0.340909, 0.350000, 0.361111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.395833, 0.400000, 0.404762, 0.410256, 0.416667, 0.424242, 0.433333, 0.444444, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.562500, 0.566667, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.062500, 1.066667, 1.071429, 1.076923, 1.083333, 1.090909, 1.100000, 1.111111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 0.562500, 0.566667, 0.571429, 0.576923, 0.583333, 0.590909, 0.600000, 0.611111, },
-{1.071429, 0.571429, 0.404762, 0.321429, 0.271429, 0.238095, 0.214286, 0.196429, 0.182540, 0.171429, 0.162338, 0.154762, 0.148352, 0.142857, 0.138095, 0.133929, 1.076923, 0.576923, 0.410256, 0.326923, 0.276923, 0.243590, 0.219780, 0.201923, 0.188034, 0.176923, 0.167832, 0.160256, 0.153846, 0.148352, 0.143590, 0.139423, 1.083333, 0.583333, 0.416667, 0.333333, 0.283333, 0.250000, 0.226190, 0.208333, 0.194444, 0.183333, 0.174242, 0.166667, 0.160256, 0.154762, 0.150000, 0.145833, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.215909, 0.202020, 0.190909, 0.181818, 0.174242, 0.167832, 0.162338, 0.157576, 0.153409, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.200000, 0.190909, 0.183333, 0.176923, 0.171429, 0.166667, 0.162500, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.202020, 0.194444, 0.188034, 0.182540, 0.177778, 0.173611, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.208333, 0.201923, 0.196429, 0.191667, 0.187500, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.219780, 0.214286, 0.209524, 0.205357, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.238095, 0.233333, 0.229167, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.271429, 0.266667, 0.262500, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.321429, 0.316667, 0.312500, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.400000, 0.395833, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 0.566667, 0.562500, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, 1.125000, },
-{0.571429, 1.071429, 0.571429, 0.404762, 0.321429, 0.271429, 0.238095, 0.214286, 0.196429, 0.182540, 0.171429, 0.162338, 0.154762, 0.148352, 0.142857, 0.138095, 0.576923, 1.076923, 0.576923, 0.410256, 0.326923, 0.276923, 0.243590, 0.219780, 0.201923, 0.188034, 0.176923, 0.167832, 0.160256, 0.153846, 0.148352, 0.143590, 0.583333, 1.083333, 0.583333, 0.416667, 0.333333, 0.283333, 0.250000, 0.226190, 0.208333, 0.194444, 0.183333, 0.174242, 0.166667, 0.160256, 0.154762, 0.150000, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.215909, 0.202020, 0.190909, 0.181818, 0.174242, 0.167832, 0.162338, 0.157576, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.200000, 0.190909, 0.183333, 0.176923, 0.171429, 0.166667, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.202020, 0.194444, 0.188034, 0.182540, 0.177778, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.208333, 0.201923, 0.196429, 0.191667, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.219780, 0.214286, 0.209524, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.238095, 0.233333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.271429, 0.266667, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.321429, 0.316667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.400000, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 0.566667, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, 1.142857, },
-{0.404762, 0.571429, 1.071429, 0.571429, 0.404762, 0.321429, 0.271429, 0.238095, 0.214286, 0.196429, 0.182540, 0.171429, 0.162338, 0.154762, 0.148352, 0.142857, 0.410256, 0.576923, 1.076923, 0.576923, 0.410256, 0.326923, 0.276923, 0.243590, 0.219780, 0.201923, 0.188034, 0.176923, 0.167832, 0.160256, 0.153846, 0.148352, 0.416667, 0.583333, 1.083333, 0.583333, 0.416667, 0.333333, 0.283333, 0.250000, 0.226190, 0.208333, 0.194444, 0.183333, 0.174242, 0.166667, 0.160256, 0.154762, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.215909, 0.202020, 0.190909, 0.181818, 0.174242, 0.167832, 0.162338, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.200000, 0.190909, 0.183333, 0.176923, 0.171429, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.202020, 0.194444, 0.188034, 0.182540, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.208333, 0.201923, 0.196429, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.219780, 0.214286, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.238095, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.271429, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.321429, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.404762, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 0.571429, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, 1.166667, },
-{0.321429, 0.404762, 0.571429, 1.071429, 0.571429, 0.404762, 0.321429, 0.271429, 0.238095, 0.214286, 0.196429, 0.182540, 0.171429, 0.162338, 0.154762, 0.148352, 0.326923, 0.410256, 0.576923, 1.076923, 0.576923, 0.410256, 0.326923, 0.276923, 0.243590, 0.219780, 0.201923, 0.188034, 0.176923, 0.167832, 0.160256, 0.153846, 0.333333, 0.416667, 0.583333, 1.083333, 0.583333, 0.416667, 0.333333, 0.283333, 0.250000, 0.226190, 0.208333, 0.194444, 0.183333, 0.174242, 0.166667, 0.160256, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.215909, 0.202020, 0.190909, 0.181818, 0.174242, 0.167832, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.200000, 0.190909, 0.183333, 0.176923, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.202020, 0.194444, 0.188034, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.208333, 0.201923, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.219780, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.243590, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.276923, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.326923, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.410256, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 0.576923, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, 1.200000, },
-{0.271429, 0.321429, 0.404762, 0.571429, 1.071429, 0.571429, 0.404762, 0.321429, 0.271429, 0.238095, 0.214286, 0.196429, 0.182540, 0.171429, 0.162338, 0.154762, 0.276923, 0.326923, 0.410256, 0.576923, 1.076923, 0.576923, 0.410256, 0.326923, 0.276923, 0.243590, 0.219780, 0.201923, 0.188034, 0.176923, 0.167832, 0.160256, 0.283333, 0.333333, 0.416667, 0.583333, 1.083333, 0.583333, 0.416667, 0.333333, 0.283333, 0.250000, 0.226190, 0.208333, 0.194444, 0.183333, 0.174242, 0.166667, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.215909, 0.202020, 0.190909, 0.181818, 0.174242, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.200000, 0.190909, 0.183333, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.202020, 0.194444, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.208333, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.226190, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.250000, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.283333, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.333333, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.416667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 0.583333, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, 1.250000, },
-{0.238095, 0.271429, 0.321429, 0.404762, 0.571429, 1.071429, 0.571429, 0.404762, 0.321429, 0.271429, 0.238095, 0.214286, 0.196429, 0.182540, 0.171429, 0.162338, 0.243590, 0.276923, 0.326923, 0.410256, 0.576923, 1.076923, 0.576923, 0.410256, 0.326923, 0.276923, 0.243590, 0.219780, 0.201923, 0.188034, 0.176923, 0.167832, 0.250000, 0.283333, 0.333333, 0.416667, 0.583333, 1.083333, 0.583333, 0.416667, 0.333333, 0.283333, 0.250000, 0.226190, 0.208333, 0.194444, 0.183333, 0.174242, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.215909, 0.202020, 0.190909, 0.181818, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.200000, 0.190909, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.202020, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.215909, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.233766, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.257576, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.290909, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.340909, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.424242, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 0.590909, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, 1.333333, },
-{0.214286, 0.238095, 0.271429, 0.321429, 0.404762, 0.571429, 1.071429, 0.571429, 0.404762, 0.321429, 0.271429, 0.238095, 0.214286, 0.196429, 0.182540, 0.171429, 0.219780, 0.243590, 0.276923, 0.326923, 0.410256, 0.576923, 1.076923, 0.576923, 0.410256, 0.326923, 0.276923, 0.243590, 0.219780, 0.201923, 0.188034, 0.176923, 0.226190, 0.250000, 0.283333, 0.333333, 0.416667, 0.583333, 1.083333, 0.583333, 0.416667, 0.333333, 0.283333, 0.250000, 0.226190, 0.208333, 0.194444, 0.183333, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.215909, 0.202020, 0.190909, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.200000, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.211111, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.225000, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.242857, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.266667, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.300000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.350000, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.433333, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 0.600000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, 1.500000, },
-{0.196429, 0.214286, 0.238095, 0.271429, 0.321429, 0.404762, 0.571429, 1.071429, 0.571429, 0.404762, 0.321429, 0.271429, 0.238095, 0.214286, 0.196429, 0.182540, 0.201923, 0.219780, 0.243590, 0.276923, 0.326923, 0.410256, 0.576923, 1.076923, 0.576923, 0.410256, 0.326923, 0.276923, 0.243590, 0.219780, 0.201923, 0.188034, 0.208333, 0.226190, 0.250000, 0.283333, 0.333333, 0.416667, 0.583333, 1.083333, 0.583333, 0.416667, 0.333333, 0.283333, 0.250000, 0.226190, 0.208333, 0.194444, 0.215909, 0.233766, 0.257576, 0.290909, 0.340909, 0.424242, 0.590909, 1.090909, 0.590909, 0.424242, 0.340909, 0.290909, 0.257576, 0.233766, 0.215909, 0.202020, 0.225000, 0.242857, 0.266667, 0.300000, 0.350000, 0.433333, 0.600000, 1.100000, 0.600000, 0.433333, 0.350000, 0.300000, 0.266667, 0.242857, 0.225000, 0.211111, 0.236111, 0.253968, 0.277778, 0.311111, 0.361111, 0.444444, 0.611111, 1.111111, 0.611111, 0.444444, 0.361111, 0.311111, 0.277778, 0.253968, 0.236111, 0.222222, 0.250000, 0.267857, 0.291667, 0.325000, 0.375000, 0.458333, 0.625000, 1.125000, 0.625000, 0.458333, 0.375000, 0.325000, 0.291667, 0.267857, 0.250000, 0.236111, 0.267857, 0.285714, 0.309524, 0.342857, 0.392857, 0.476190, 0.642857, 1.142857, 0.642857, 0.476190, 0.392857, 0.342857, 0.309524, 0.285714, 0.267857, 0.253968, 0.291667, 0.309524, 0.333333, 0.366667, 0.416667, 0.500000, 0.666667, 1.166667, 0.666667, 0.500000, 0.416667, 0.366667, 0.333333, 0.309524, 0.291667, 0.277778, 0.325000, 0.342857, 0.366667, 0.400000, 0.450000, 0.533333, 0.700000, 1.200000, 0.700000, 0.533333, 0.450000, 0.400000, 0.366667, 0.342857, 0.325000, 0.311111, 0.375000, 0.392857, 0.416667, 0.450000, 0.500000, 0.583333, 0.750000, 1.250000, 0.750000, 0.583333, 0.500000, 0.450000, 0.416667, 0.392857, 0.375000, 0.361111, 0.458333, 0.476190, 0.500000, 0.533333, 0.583333, 0.666667, 0.833333, 1.333333, 0.833333, 0.666667, 0.583333, 0.533333, 0.500000, 0.476190, 0.458333, 0.444444, 0.625000, 0.642857, 0.666667, 0.700000, 0.750000, 0.833333, 1.000000, 1.500000, 1.000000, 0.833333, 0.750000, 0.700000, 0.666667, 0.642857, 0.625000, 0.611111, 1.125000, 1.142857, 1.166667, 1.200000, 1.250000, 1.333333, 1.500000, 2.000000, },
-};
-
-#endif //PRECOMP_TABLES_H
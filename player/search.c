@@ -62,6 +62,8 @@ int DETECT_DRAWS;  // Detect draws by repetition
 // do not set more than 5 ply
 int FUT_DEPTH;     // set to zero for no futilty
 
+int MERGE_TABLES;  // Merge the Cilk workers' killer and history tables
+
 
 // Declare the two main search functions.
 static score_t searchPV(searchNode *node, int depth,
@@ -78,20 +80,24 @@ void assert_sorted(sortable_move_t * move_list,int num_of_moves);
 //   https://chessprogramming.wikispaces.com/Node+Types#PV
 static void initialize_pv_node(searchNode* node, int depth) {
   node->type = SEARCH_PV;
+  node->ctx = node->parent->ctx;
   node->alpha = -node->parent->beta;
   node->orig_alpha = node->alpha;  // Save original alpha.
   node->beta = -node->parent->alpha;
-  node->subpv[0] = 0;
+  node->best_move = 0;
+  node->pv[0] = 0;
   node->depth = depth;
   node->legal_move_count = 0;
   node->ply = node->parent->ply + 1;
-  node->fake_color_to_move = color_to_move_of(&(node->position));
+  node->fake_color_to_move = color_to_move_of(node->position);
   // point of view = 1 for white, -1 for black
   node->pov = 1 - node->fake_color_to_move * 2;
   node->quiescence = (depth <= 0);
   node->best_move_index = 0;
   node->best_score = -INF;
   node->abort = false;
+  node->split = node->parent->child_split;
+  node->child_split = node->split;
 }
 
 // Perform a Principle Variation Search
@@ -100,6 +106,11 @@ static score_t searchPV(searchNode *node, int depth, uint64_t *node_count_serial
   // Initialize the searchNode data structure.
   initialize_pv_node(node, depth);
 
+  // check whether we should abort; quiescence nodes come through here too
+  if (should_abort_check(node->ctx) || parallel_parent_aborted(node)) {
+    return 0;
+  }
+
   // Pre-evaluate the node to determine if we need to search further.
   leafEvalResult pre_evaluation_result = evaluate_as_leaf(node, SEARCH_PV);
 
@@ -117,44 +128,40 @@ static score_t searchPV(searchNode *node, int depth, uint64_t *node_count_serial
   }
 
   // Get the killer moves at this node.
-  move_t killer_a = killer[KMT(node->ply, 0)];
-  move_t killer_b = killer[KMT(node->ply, 1)];
+  const searchTables *tables = tables_of(node->ctx);
+  move_t killer_a = tables->killer[KMT(node->ply, 0)];
+  move_t killer_b = tables->killer[KMT(node->ply, 1)];
 
 
-  // sortable_move_t move_list
-  //
-  // Contains a list of possible moves at this node. These moves are "sortable"
-  //   and can be compared as integers. This is accomplished by using high-order
-  //   bits to store a sort key.
-  //
-  // Keep track of the number of moves that we have considered at this node.
-  //   After we finish searching moves at this node the move_list array will
-  //   be organized in the following way:
+  // The move picker hands out the moves of this node lazily, best first (see
+  //   search_common.c).  Its move_list is kept in the following way:
   //
   //   m0, m1, ... , m_k-1, m_k, ... , m_N-1
   //
-  //  where k = num_moves_tried, and N = num_of_moves
+  //  where m0 ... m_k-1 are the k moves handed out so far, in order.
   //
   //  This will allow us to update the best_move_history table easily by
   //  scanning move_list from index 0 to k such that we update the table
   //  only for moves that we actually considered at this node.
-  sortable_move_t move_list[MAX_NUM_MOVES];
-  int num_of_moves = get_sortable_move_list(node, move_list, hash_table_move);
-  int num_moves_tried = 0;
+  movePicker picker;
+  init_move_picker(&picker, node, hash_table_move);
+
+  move_t child_pv[MAX_PLY_IN_SEARCH];
+  child_pv[0] = 0;
 
   moveEvaluationResult result;
-  result.next_node.subpv[0] = 0;
+  result.next_node.pv = child_pv;
   result.next_node.parent = node;
+  result.next_node.position = node->position;  // moves are made in place
 
-  // Start searching moves.
-  for (int mv_index = 0; mv_index < num_of_moves; mv_index++) {
-    // Incrementally sort the move list.
-    sort_incremental_new(move_list, num_of_moves, mv_index);
+  // Search serially until the first legal move has been searched (young
+  //   brothers wait), or throughout in quiescence and in a serial search.
+  move_t mv;
+  while ((node->legal_move_count == 0 || node->quiescence ||
+          node->ctx->serial) && (mv = next_move(&picker)) != 0) {
+    int mv_index = picker.next - 1;
 
-    move_t mv = get_move(move_list[mv_index]);
-
-    num_moves_tried++;
-    (*node_count_serial)++;
+    __sync_fetch_and_add(node_count_serial, 1);
 
     evaluateMove(node, mv, killer_a, killer_b,
                  SEARCH_PV,
@@ -171,20 +178,91 @@ static score_t searchPV(searchNode *node, int depth, uint64_t *node_count_serial
       node->legal_move_count++;
     }
 
-    // Check if we should abort due to time control.
-    if (abortf) {
+    // Check if we should abort due to time control, or because a parallel
+    // search above this node has cut off.
+    if (should_abort() || parallel_parent_aborted(node)) {
       return 0;
     }
 
     bool cutoff = search_process_score(node, mv, mv_index, &result, SEARCH_PV);
     if (cutoff) {
+      node->abort = true;
       break;
     }
   }
 
+  int number_of_moves_evaluated = picker.next;
+
+  // The rest of the moves are searched in parallel.  evaluate_made_move()
+  //   scout searches each of them and re-searches the ones that raise alpha.
+  if (!node->abort) {
+    const int start_value = number_of_moves_evaluated;
+    const int num_of_moves = drain_move_picker(&picker);
+    sortable_move_t *move_list = picker.move_list;
+
+    if (start_value < num_of_moves) {
+      simple_mutex_t node_mutex;
+      init_simple_mutex(&node_mutex);
+
+      splitPoint sp;
+      open_split_point(&sp, node);
+
+      cilk_for (int mv_index = start_value; mv_index < num_of_moves;
+                mv_index++) {
+        if (split_aborted(&sp) || should_abort()) continue;
+        int local_index = __sync_fetch_and_add(&number_of_moves_evaluated, 1);
+        move_t mv = get_move(move_list[local_index]);
+
+        uint64_t child_nodes = 1;
+
+        // Siblings run in parallel, so each one works on its own copy.
+        position_t position = *(node->position);
+
+        move_t child_pv[MAX_PLY_IN_SEARCH];
+        child_pv[0] = 0;
+
+        moveEvaluationResult result;
+        result.next_node.pv = child_pv;
+        result.next_node.parent = node;
+        result.next_node.position = &position;
+
+        evaluateMove(node, mv, killer_a, killer_b,
+                     SEARCH_PV,
+                     &child_nodes,
+                     &result);
+        __sync_fetch_and_add(node_count_serial, child_nodes);
+
+        if (result.type == MOVE_ILLEGAL || result.type == MOVE_IGNORE
+            || should_abort() || split_child_discarded(&sp, child_nodes)) {
+          continue;
+        }
+
+        if (result.type == MOVE_EVALUATED) {
+          __sync_fetch_and_add(&node->legal_move_count, 1);
+        }
+
+        // A sibling may have cut off while this one was searched.
+        simple_acquire(&node_mutex);
+        bool cutoff = !split_aborted(&sp) &&
+            search_process_score(node, mv, local_index, &result, SEARCH_PV);
+        simple_release(&node_mutex);
+        if (cutoff) {
+          node->abort = true;
+          abort_split_point(&sp, true);
+        }
+      }
+
+      close_split_point(&sp, node);
+    }
+
+    if (should_abort() || parallel_parent_aborted(node)) {
+      return 0;
+    }
+  }
+
   if (node->quiescence == false) {
-    update_best_move_history(&(node->position), node->best_move_index,
-                             move_list, num_moves_tried);
+    update_best_move_history(node->ctx, node->position, node->best_move_index,
+                             picker.move_list, number_of_moves_evaluated);
   }
 
   tbassert(abs(node->best_score) != -INF, "best_score = %d\n",
@@ -193,8 +271,8 @@ static score_t searchPV(searchNode *node, int depth, uint64_t *node_count_serial
   // Update the transposition table.
   //
   // Note: This function reads node->best_score, node->orig_alpha,
-  //   node->position.key, node->depth, node->ply, node->beta,
-  //   node->alpha, node->subpv
+  //   node->position->key, node->depth, node->ply, node->beta,
+  //   node->alpha, node->best_move
   update_transposition_table(node);
 
   return node->best_score;
@@ -205,149 +283,311 @@ static score_t searchPV(searchNode *node, int depth, uint64_t *node_count_serial
 //
 // This handles scout search logic for the first level of the search tree
 // -----------------------------------------------------------------------------
-static void initialize_root_node(searchNode *node, score_t alpha, score_t beta, int depth,
-                            int ply, position_t* p) {
+static void initialize_root_node(searchNode *node, searchContext *ctx,
+                                 score_t alpha, score_t beta, int depth,
+                                 int ply, position_t* p) {
   node->type = SEARCH_ROOT;
+  node->ctx = ctx;
   node->alpha = alpha;
   node->beta = beta;
   node->depth = depth;
   node->ply = ply;
-  node->position = *p;
-  node->fake_color_to_move = color_to_move_of(&(node->position));
-  node->best_score = -INF;
+  node->position = p;
+  node->fake_color_to_move = color_to_move_of(node->position);
+  node->best_score = alpha;  // fail hard on the low side
   node->pov = 1 - node->fake_color_to_move * 2;  // pov = 1 for White, -1 for Black
   node->abort = false;
+  node->split = NULL;
+  node->child_split = NULL;
+  node->best_move = 0;
+  node->pv = NULL;  // searchRoot() keeps the line
 }
 
-score_t searchRoot(position_t *p, score_t alpha, score_t beta, int depth,
-                   int ply, move_t *pv, uint64_t *node_count_serial,
-                   FILE *OUT) {
-  static int num_of_moves = 0;  // number of moves in list
-  // hopefully, more than we will need
-  static sortable_move_t move_list[MAX_NUM_MOVES];
-
-  if (depth == 1) {
-    // we are at depth 1; generate all possible moves
-    num_of_moves = generate_all(p, move_list, false);
-    // shuffle the list of moves
-    for (int i = 0; i < num_of_moves; i++) {
-      int r = myrand() % num_of_moves;
-      sortable_move_t tmp = move_list[i];
-      move_list[i] = move_list[r];
-      move_list[r] = tmp;
+// Builds the key stack for the game history that led to the root, back to
+// (and including) the last position reached by an irreversible move; no
+// repetition can reach past it.  The sentinel positions made by fen_to_pos()
+// have victims, so the walk always stops.
+static const key_stack_t *seed_game_keys(searchContext *ctx,
+                                         const position_t *x) {
+  key_stack_t *game_keys = ctx->game_keys;
+
+  int n = 0;
+  while (true) {
+    tbassert(x != NULL, "ran off the game history\n");
+    game_keys[n].key = x->key;
+    game_keys[n].reversible = zero_victims(x->victims);
+    game_keys[n].prev = NULL;
+    if (n > 0) {
+      game_keys[n - 1].prev = &game_keys[n];
     }
+    n++;
+    if (!game_keys[n - 1].reversible || n == MAX_PLY_IN_GAME) {
+      break;
+    }
+    x = x->history;
   }
+  game_keys[n - 1].reversible = false;  // in case we ran out of room
+  return &game_keys[0];
+}
 
-  searchNode rootNode;
-  rootNode.parent = NULL;
-  initialize_root_node(&rootNode, alpha, beta, depth, ply, p);
-
-  assert(rootNode.best_score == alpha);  // initial conditions
+// Readies ctx for a search from p: clears the history tables and generates
+// the root moves, in random order.  Serial contexts search without cilk_for.
+void init_search_context(searchContext *ctx, position_t *p, bool serial) {
+  ctx->serial = serial;
+  if (!serial) {
+    reset_worker_tables();
+  }
+  clear_best_move_history(ctx);
+  ctx->tics = 0;
+  ctx->splits = 0;
+  ctx->aborts = 0;
+  ctx->wasted_nodes = 0;
+
+  sortable_move_t *move_list = ctx->root_moves;
+  const int num_of_moves = generate_all(p, move_list, false);
+  // shuffle the list of moves
+  for (int i = 0; i < num_of_moves; i++) {
+    int r = myrand() % num_of_moves;
+    sortable_move_t tmp = move_list[i];
+    move_list[i] = move_list[r];
+    move_list[r] = tmp;
+  }
+  ctx->num_root_moves = num_of_moves;
+}
 
-  searchNode next_node;
-  next_node.subpv[0] = 0;
-  next_node.parent = &rootNode;
+// Searches root move mv on next_node->position, which holds the root position
+// and is left as it was found.  The move is searched with searchPV if
+// pv_search, and otherwise with scout_search and then, if it raises alpha,
+// again with searchPV.  Returns false if mv is not legal.
+static bool search_root_move(searchNode *rootNode, searchNode *next_node,
+                             move_t mv, bool pv_search, score_t *score,
+                             uint64_t *node_count_serial) {
+  position_t *p = next_node->position;
+  undo_t undo;
+
+  if (TRACE_MOVES) {
+    print_move_info(mv, rootNode->ply);
+  }
 
-  score_t score;
+  __sync_fetch_and_add(node_count_serial, 1);
+  // make the move.
+  victims_t x = do_move(p, mv, &undo);
+  if (is_KO(x)) {
+    undo_move(p, &undo);
+    return false;  // not a legal move
+  }
+  push_key(&(next_node->keys), p, &(rootNode->keys));
+
+  if (is_game_over(x, rootNode->pov, rootNode->ply)) {
+    *score = get_game_over_score(x, rootNode->pov, rootNode->ply);
+    next_node->pv[0] = 0;
+  } else if (is_repeated(&(next_node->keys))) {
+    *score = get_draw_score(&(next_node->keys), rootNode->ply);
+    next_node->pv[0] = 0;
+  } else if (pv_search) {
+    // We guess that the first move is the principle variation
+    *score = -searchPV(next_node, rootNode->depth-1, node_count_serial);
+  } else {
+    *score = -scout_search(next_node, rootNode->depth-1, node_count_serial);
+    // If its score exceeds the current best score,
+    if (!should_abort() && *score > rootNode->alpha) {
+      *score = -searchPV(next_node, rootNode->depth-1, node_count_serial);
+    }
+  }
 
-  for (int mv_index = 0; mv_index < num_of_moves; mv_index++) {
-    move_t mv = get_move(move_list[mv_index]);
+  undo_move(p, &undo);
+  return true;
+}
 
-    if (TRACE_MOVES) {
-      print_move_info(mv, ply);
-    }
+// Records the score of root move mv, the mv_index-th in the move list.  A new
+// best move goes into pv, is reported on OUT and slides to the front of the
+// move list of ctx.  Returns true on a beta cutoff.
+static bool record_root_score(searchContext *ctx, searchNode *rootNode,
+                              const searchNode *next_node, move_t mv,
+                              int mv_index, score_t score, move_t *pv,
+                              uint64_t *node_count_serial, FILE *OUT) {
+  // only valid for the root node:
+  tbassert((score > rootNode->best_score) == (score > rootNode->alpha),
+           "score = %d, best = %d, alpha = %d\n", score, rootNode->best_score,
+           rootNode->alpha);
+
+  if (score > rootNode->best_score) {
+    tbassert(score > rootNode->alpha, "score: %d, alpha: %d\n", score,
+             rootNode->alpha);
+
+    rootNode->best_score = score;
+    set_pv(pv, mv, next_node->pv);
+
+    // Print out based on UCI (universal chess interface)
+    if (OUT != NULL) {
+      double et = elapsed_time();
+      char   pvbuf[MAX_PLY_IN_SEARCH * MAX_CHARS_IN_MOVE];
+      getPV(pv, pvbuf, MAX_PLY_IN_SEARCH * MAX_CHARS_IN_MOVE);
+      if (et < 0.00001) {
+        et = 0.00001;  // hack so that we don't divide by 0
+      }
 
-    (*node_count_serial)++;
-    // make the move.
-    victims_t x = make_move(&(rootNode.position), &(next_node.position), mv);
-    if (is_KO(x)) {
-      continue;  // not a legal move
+      uint64_t nps = 1000 * *node_count_serial / et;
+      fprintf(OUT, "info depth %d move_no %d time (microsec) %d nodes %"
+              PRIu64 " nps %" PRIu64 "\n", rootNode->depth, mv_index + 1,
+              (int) (et * 1000), *node_count_serial, nps);
+      fprintf(OUT, "info score cp %d pv %s\n", score, pvbuf);
     }
 
-    if (is_game_over(x, rootNode.pov, rootNode.ply)) {
-      score = get_game_over_score(x, rootNode.pov, rootNode.ply);
-      next_node.subpv[0] = 0;
-      goto scored;
+    // Slide this move to the front of the move list.  Earlier slides may
+    // have moved it along, so look for it.
+    sortable_move_t *move_list = ctx->root_moves;
+    int j = 0;
+    while (get_move(move_list[j]) != mv) {
+      j++;
     }
-
-    if (is_repeated(&(next_node.position), rootNode.ply)) {
-      score = get_draw_score(&(next_node.position), rootNode.ply);
-      next_node.subpv[0] = 0;
-      goto scored;
+    for (; j > 0; j--) {
+      move_list[j] = move_list[j - 1];
     }
+    move_list[0] = mv;
+  }
 
-    if (mv_index == 0 || rootNode.depth == 1) {
-      // We guess that the first move is the principle variation
-      score = -searchPV(&next_node, rootNode.depth-1, node_count_serial);
-      // Check if we should abort due to time control.
-      if (abortf) {
-        return 0;
-      }
-    } else {
-      score = -scout_search(&next_node, rootNode.depth-1, node_count_serial);
-      // Check if we should abort due to time control.
-      if (abortf) {
-        return 0;
-      }
+  // Normal alpha-beta logic: if the current score is better than what the
+  // maximizer has been able to get so far, take that new value.  Likewise,
+  // score >= beta is the beta cutoff condition, which only an aspiration
+  // window can meet.
+  if (score > rootNode->alpha) {
+    rootNode->alpha = score;
+  }
+  if (score >= rootNode->beta) {
+    return true;
+  }
+  return false;
+}
 
-      // If its score exceeds the current best score,
-      if (score > rootNode.alpha) {
-        score = -searchPV(&next_node, rootNode.depth-1, node_count_serial);
-        // Check if we should abort due to time control.
-        if (abortf) {
-          return 0;
-        }
-      }
+// Searches the root moves of ctx, which must have been readied for p by
+// init_search_context().  The move list keeps the best move found at the
+// front for the next iteration.  Nothing is printed if OUT is NULL.
+//
+// A score of alpha or less is returned as alpha, with pv left alone; a
+// score of beta or more is a lower bound, with the move that got it in pv.
+//
+// The first move is searched alone with searchPV (young brothers wait) and
+// the rest in parallel, except at depth 1 and in a serial search.
+score_t searchRoot(searchContext *ctx, position_t *p, score_t alpha,
+                   score_t beta, int depth, int ply, move_t *pv,
+                   uint64_t *node_count_serial, FILE *OUT) {
+  const int num_of_moves = ctx->num_root_moves;
+  sortable_move_t *move_list = ctx->root_moves;
 
-    }
+  // The search makes and unmakes moves in place, so work on a copy.
+  position_t root_position = *p;
 
-  scored:
+  searchNode rootNode;
+  rootNode.parent = NULL;
+  initialize_root_node(&rootNode, ctx, alpha, beta, depth, ply,
+                       &root_position);
+  push_key(&(rootNode.keys), p, seed_game_keys(ctx, p->history));
 
-    // only valid for the root node:
-    tbassert((score > rootNode.best_score) == (score > rootNode.alpha),
-             "score = %d, best = %d, alpha = %d\n", score, rootNode.best_score, rootNode.alpha);
+  assert(rootNode.best_score == alpha);  // initial conditions
 
-    if (score > rootNode.best_score) {
-      tbassert(score > rootNode.alpha, "score: %d, alpha: %d\n", score, rootNode.alpha);
+  move_t child_pv[MAX_PLY_IN_SEARCH];
+  child_pv[0] = 0;
 
-      rootNode.best_score = score;
-      pv[0] = mv;
-      memcpy(pv+1, next_node.subpv, sizeof(move_t) * (MAX_PLY_IN_SEARCH - 1));
-      pv[MAX_PLY_IN_SEARCH - 1] = 0;
+  searchNode next_node;
+  next_node.pv = child_pv;
+  next_node.parent = &rootNode;
+  next_node.position = &root_position;
 
-      // Print out based on UCI (universal chess interface)
-      double et = elapsed_time();
-      char   pvbuf[MAX_PLY_IN_SEARCH * MAX_CHARS_IN_MOVE];
-      getPV(pv, pvbuf, MAX_PLY_IN_SEARCH * MAX_CHARS_IN_MOVE);
-      if (et < 0.00001) {
-        et = 0.00001;  // hack so that we don't divide by 0
-      }
+  const bool serial = ctx->serial || depth == 1;
 
-      uint64_t nps = 1000 * *node_count_serial / et;
-      fprintf(OUT, "info depth %d move_no %d time (microsec) %d nodes %" PRIu64
-              " nps %" PRIu64 "\n",
-              depth, mv_index + 1, (int) (et * 1000), *node_count_serial, nps);
-      fprintf(OUT, "info score cp %d pv %s\n", score, pvbuf);
+  ctx->best_move_nodes = 0;
 
-      // Slide this move to the front of the move list
-      for (int j = mv_index; j > 0; j--) {
-        move_list[j] = move_list[j - 1];
-      }
-      move_list[0] = mv;
+  int mv_index = 0;
+  for (; mv_index < num_of_moves && (mv_index == 0 || serial); mv_index++) {
+    move_t mv = get_move(move_list[mv_index]);
+    score_t score;
+
+    // Nothing else is searched meanwhile, so the counter tells the nodes
+    // below this move.
+    const uint64_t nodes_before = *node_count_serial;
+    if (!search_root_move(&rootNode, &next_node, mv,
+                          mv_index == 0 || depth == 1, &score,
+                          node_count_serial)) {
+      continue;
+    }
+    // Check if we should abort due to time control.
+    if (should_abort()) {
+      return 0;
     }
 
-    // Normal alpha-beta logic: if the current score is better than what the
-    // maximizer has been able to get so far, take that new value.  Likewise,
-    // score >= beta is the beta cutoff condition
-    if (score > rootNode.alpha) {
-      rootNode.alpha = score;
+    const score_t best_score = rootNode.best_score;
+    bool cutoff = record_root_score(ctx, &rootNode, &next_node, mv, mv_index,
+                                    score, pv, node_count_serial, OUT);
+    if (rootNode.best_score > best_score) {
+      ctx->best_move_nodes = *node_count_serial - nodes_before;
     }
-    if (score >= rootNode.beta) {
-      tbassert(0, "score: %d, beta: %d\n", score, rootNode.beta);
+    if (cutoff) {
+      rootNode.abort = true;
       break;
     }
   }
 
+  if (mv_index < num_of_moves && !rootNode.abort) {
+    // New best moves slide to the front of the move list while the siblings
+    // are searched, so take the moves from a copy.
+    sortable_move_t moves[MAX_NUM_MOVES];
+    memcpy(moves, move_list, sizeof(sortable_move_t) * num_of_moves);
+
+    simple_mutex_t root_mutex;
+    init_simple_mutex(&root_mutex);
+
+    splitPoint sp;
+    open_split_point(&sp, &rootNode);
+
+    cilk_for (int i = mv_index; i < num_of_moves; i++) {
+      if (split_aborted(&sp) || should_abort()) continue;
+      move_t mv = get_move(moves[i]);
+      score_t score;
+      uint64_t child_nodes = 0;
+
+      // Siblings run in parallel, so each one works on its own copy.
+      position_t position = root_position;
+
+      move_t child_pv[MAX_PLY_IN_SEARCH];
+      child_pv[0] = 0;
+
+      searchNode next_node;
+      next_node.pv = child_pv;
+      next_node.parent = &rootNode;
+      next_node.position = &position;
+
+      bool legal = search_root_move(&rootNode, &next_node, mv, false, &score,
+                                    &child_nodes);
+      __sync_fetch_and_add(node_count_serial, child_nodes);
+      if (!legal || should_abort()
+          || split_child_discarded(&sp, child_nodes)) {
+        continue;
+      }
+
+      simple_acquire(&root_mutex);
+      const score_t best_score = rootNode.best_score;
+      bool cutoff = !split_aborted(&sp) &&
+          record_root_score(ctx, &rootNode, &next_node, mv, i, score, pv,
+                            node_count_serial, OUT);
+      if (rootNode.best_score > best_score) {
+        ctx->best_move_nodes = child_nodes;
+      }
+      simple_release(&root_mutex);
+      if (cutoff) {
+        rootNode.abort = true;
+        abort_split_point(&sp, true);
+      }
+    }
+
+    close_split_point(&sp, &rootNode);
+
+    // Check if we should abort due to time control.
+    if (should_abort()) {
+      return 0;
+    }
+  }
+
   return rootNode.best_score;
 }
 
@@ -43,8 +43,62 @@ typedef enum searchType {  // different types of search
   SEARCH_SCOUT
 } searchType_t;
 
+// The hash keys along the line being searched, for repetition detection.
+// Each search node owns the entry for its own position and links to its
+// parent's, so the stack lives in the (cactus) call stack and parallel
+// branches share their common prefix.  Positions themselves are made and
+// unmade in place and keep no history.
+typedef struct key_stack {
+  uint64_t key;
+  bool reversible;              // no victims on the move that led here
+  const struct key_stack *prev;
+} key_stack_t;
+
+// The tables that order the moves: the killer moves and the best move
+// history.
+typedef struct searchTables {
+  move_t killer[4 * MAX_PLY_IN_SEARCH];             // up to 4 killers a ply
+  int best_move_history[2 * 6 * ARR_SIZE * NUM_ORI];
+} searchTables;
+
+// The state a search thread keeps besides the nodes themselves: the tables
+// that order the moves, the root move list, which keeps its order from one
+// iteration to the next, and the key stack of the game history.  The Cilk
+// search runs on one context; each Lazy SMP thread has its own, so that the
+// threads share only the transposition table.
+typedef struct searchContext {
+  searchTables tables;  // a serial search's; Cilk workers have their own
+  int num_root_moves;
+  sortable_move_t root_moves[MAX_NUM_MOVES];
+  key_stack_t game_keys[MAX_PLY_IN_GAME];
+  int tics;     // tic counter for how often we should check for abort
+  bool serial;  // search every node serially (no cilk_for)
+  uint64_t best_move_nodes;  // below the best move of the last searchRoot
+
+  // split point statistics
+  uint64_t splits;        // split points opened
+  uint64_t aborts;        // split points aborted, by a cutoff or from above
+  uint64_t wasted_nodes;  // nodes searched by children a cutoff discarded
+} searchContext;
+
+// A split point: a node whose remaining moves are being searched in
+// parallel.  Its abort word is set when the node cuts off or a split point
+// above it aborts, and the nodes below check only the abort word of their
+// innermost split point.  Open split points register with the one above
+// them, so that an abort is pushed down to all of them at once.
+typedef struct splitPoint {
+  int abort;      // read and written atomically
+  bool cutoff;    // aborted by a cutoff here, rather than from above
+  int lock;       // a simple_mutex_t guarding children and abort
+  searchContext *ctx;
+  struct splitPoint *parent;
+  struct splitPoint *children;    // open split points just below this one
+  struct splitPoint *prev, *next;  // siblings in parent->children
+} splitPoint;
+
 typedef struct searchNode {
   struct searchNode* parent;
+  searchContext *ctx;
   searchType_t type;
   score_t orig_alpha;
   score_t alpha;
@@ -55,24 +109,35 @@ typedef struct searchNode {
   int quiescence;
   int pov;
   int legal_move_count;
-  bool abort;
+  bool abort;               // cut off
+  splitPoint *split;        // innermost split point above, or NULL
+  splitPoint *child_split;  // the children's: split, or this node's own
   score_t best_score;
   int best_move_index;
-  position_t position;
-  move_t subpv[MAX_PLY_IN_SEARCH];
+  move_t best_move;         // the move that got best_score, or 0
+  position_t *position;
+  key_stack_t keys;
+  // The principal variation below this node, or NULL in nodes that need
+  // none.  Each PV node keeps the line of the child being searched in its
+  // own frame, so the lines form a triangular table spread over the (cactus)
+  // stack, and parallel children do not share rows.  Scout nodes keep no
+  // lines for their children, so below a scout node a line is a single move.
+  move_t *pv;
 } searchNode;
 
 
-void init_tics();
 void init_abort_timer(double goal_time);
 double elapsed_time();
 bool should_abort();
 void reset_abort();
-void init_best_move_history();
+void abort_search();
+void init_search_context(searchContext *ctx, position_t *p, bool serial);
+void merge_search_tables(searchContext *ctx);
 move_t get_move(sortable_move_t sortable_mv);
-score_t searchRoot(position_t *p, score_t alpha, score_t beta, int depth,
-                   int ply, move_t *pv, uint64_t *node_count_serial,
-                   FILE *OUT);
+void getPV(move_t *pv, char *buf, size_t bufsize);
+score_t searchRoot(searchContext *ctx, position_t *p, score_t alpha,
+                   score_t beta, int depth, int ply, move_t *pv,
+                   uint64_t *node_count_serial, FILE *OUT);
 
 
 #endif  // SEARCH_H
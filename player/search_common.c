@@ -9,11 +9,18 @@ void qsort( void *buf, size_t num, size_t size, int (*compare)(const void *, con
 
 int compare(const void * a, const void * b);
 
-// tic counter for how often we should check for abort
-static int     tics = 0;
 static double  sstart;    // start time of a search in milliseconds
 static double  timeout;   // time elapsed before abort
-static bool    abortf = false;  // abort flag for search
+static bool    abortf = false;  // abort flag for search, read and written atomically
+
+// The watchdog thread sets the abort flag when the time is up, so that the
+// search only has to test the flag, and stops on time however slowly it is
+// visiting nodes.  init_abort_timer() arms it with a new timeout.
+static pthread_mutex_t watchdog_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t  watchdog_cond = PTHREAD_COND_INITIALIZER;
+static pthread_once_t  watchdog_once = PTHREAD_ONCE_INIT;
+static bool watchdog_running = false;  // else should_abort_check() polls
+static bool watchdog_armed = false;    // timeout is still to come
 
 static score_t fmarg[10] = {
   0, PAWN_VALUE / 2, PAWN_VALUE, (PAWN_VALUE * 5) / 2, (PAWN_VALUE * 9) / 2,
@@ -60,10 +67,53 @@ static void set_sort_key(sortable_move_t *mv, sort_key_t key) {
   return;
 }
 
+// Longest the watchdog sleeps at a time, in milliseconds.  Bounds the wait
+// computed for an infinite timeout.
+#define WATCHDOG_MAX_WAIT 1000.0
+
+static void *watchdog_main(void *arg) {
+  pthread_mutex_lock(&watchdog_mutex);
+  while (true) {
+    double wait = WATCHDOG_MAX_WAIT;
+    if (watchdog_armed) {
+      double left = timeout - milliseconds();
+      if (left <= 0) {
+        abort_search();
+        watchdog_armed = false;
+      } else if (left < wait) {
+        wait = left;
+      }
+    }
+
+    // Condition variables time out against the real-time clock.
+    struct timespec until;
+    clock_gettime(CLOCK_REALTIME, &until);
+    until.tv_nsec += (long) (wait * 1000000.0);
+    until.tv_sec += until.tv_nsec / 1000000000L;
+    until.tv_nsec %= 1000000000L;
+    pthread_cond_timedwait(&watchdog_cond, &watchdog_mutex, &until);
+  }
+  return NULL;
+}
+
+static void start_watchdog() {
+  pthread_t watchdog;
+  if (pthread_create(&watchdog, NULL, watchdog_main, NULL) == 0) {
+    pthread_detach(watchdog);
+    watchdog_running = true;
+  }
+}
+
 void init_abort_timer(double goal_time) {
+  pthread_once(&watchdog_once, start_watchdog);
+
+  pthread_mutex_lock(&watchdog_mutex);
   sstart = milliseconds();
   // don't go over any more than 3 times the goal
   timeout = sstart + goal_time * 3.0;
+  watchdog_armed = true;
+  pthread_cond_signal(&watchdog_cond);
+  pthread_mutex_unlock(&watchdog_mutex);
 }
 
 double elapsed_time() {
@@ -71,31 +121,33 @@ double elapsed_time() {
 }
 
 bool should_abort() {
-  return abortf;
+  return __atomic_load_n(&abortf, __ATOMIC_RELAXED);
 }
 
 void reset_abort() {
-  abortf = false;
+  __atomic_store_n(&abortf, false, __ATOMIC_RELAXED);
 }
 
-void init_tics() {
-  tics = 0;
+// Stops the search, in every thread searching.  Called by the watchdog when
+// the time is up, and by the UCI thread on "stop".
+void abort_search() {
+  __atomic_store_n(&abortf, true, __ATOMIC_RELAXED);
 }
 
 move_t get_move(sortable_move_t sortable_mv) {
   return (move_t) (sortable_mv & MOVE_MASK);
 }
 
-static score_t get_draw_score(position_t *p, int ply) {
-  position_t *x = p->history;
-  uint64_t cur = p->key;
+static score_t get_draw_score(const key_stack_t *keys, int ply) {
+  const key_stack_t *x = keys->prev;
+  uint64_t cur = keys->key;
   score_t score;
   while (true) {
-    if (!zero_victims(x->victims)) {
+    if (!x->reversible) {
       break;  // cannot be a repetition
     }
-    x = x->history;
-    if (!zero_victims(x->victims)) {
+    x = x->prev;
+    if (!x->reversible) {
       break;  // cannot be a repetition
     }
     if (x->key == cur) {  // is a repetition
@@ -106,7 +158,7 @@ static score_t get_draw_score(position_t *p, int ply) {
       }
       return score;
     }
-    x = x->history;
+    x = x->prev;
   }
   assert(false);  // This should not occur.
   return (score_t) 0;
@@ -115,30 +167,38 @@ static score_t get_draw_score(position_t *p, int ply) {
 
 
 // Detect move repetition
-static bool is_repeated(position_t *p, int ply) {
+static bool is_repeated(const key_stack_t *keys) {
   if (!DETECT_DRAWS) {
     return false;  // no draw detected
   }
 
-  position_t *x = p->history;
-  uint64_t cur = p->key;
+  const key_stack_t *x = keys->prev;
+  uint64_t cur = keys->key;
 
   while (true) {
-    if (!zero_victims(x->victims)) {
+    if (!x->reversible) {
       break;  // cannot be a repetition
     }
-    x = x->history;
-    if (!zero_victims(x->victims)) {
+    x = x->prev;
+    if (!x->reversible) {
       break;  // cannot be a repetition
     }
     if (x->key == cur) {  // is a repetition
       return true;
     }
-    x = x->history;
+    x = x->prev;
   }
   return false;
 }
 
+// Pushes the entry for the position just reached by a move from parent.
+static void push_key(key_stack_t *keys, const position_t *p,
+                     const key_stack_t *parent) {
+  keys->key = p->key;
+  keys->reversible = zero_victims(p->victims);
+  keys->prev = parent;
+}
+
 
 
 // check the victim pieces returned by the move to determine if it's a
@@ -168,7 +228,7 @@ static score_t get_game_over_score(victims_t victims, int pov, int ply) {
   return score;
 }
 
-static void getPV(move_t *pv, char *buf, size_t bufsize) {
+void getPV(move_t *pv, char *buf, size_t bufsize) {
   buf[0] = 0;
 
   for (int i = 0; i < (MAX_PLY_IN_SEARCH - 1) && pv[i] != 0; i++) {
@@ -202,18 +262,18 @@ leafEvalResult evaluate_as_leaf(searchNode *node, searchType_t type) {
   result.hash_table_move = 0;
 
   // get transposition table record if available.
-  ttRec_t *rec = tt_hashtable_get(node->position.key);
-  if (rec) {
-    if (type == SEARCH_SCOUT && tt_is_usable(rec, node->depth, node->beta)) {
+  ttRec_t rec;
+  if (tt_hashtable_get(node->position->key, &rec)) {
+    if (type == SEARCH_SCOUT && tt_is_usable(&rec, node->depth, node->beta)) {
       result.type = MOVE_EVALUATED;
-      result.score = tt_adjust_score_from_hashtable(rec, node->ply);
+      result.score = tt_adjust_score_from_hashtable(&rec, node->ply);
       return result;
     }
-    result.hash_table_move = tt_move_of(rec);
+    result.hash_table_move = tt_move_of(&rec);
   }
 
   // stand pat (having-the-move) bonus
-  score_t sps = eval(&(node->position), false) + HMB;
+  score_t sps = eval(node->position, false) + HMB;
   bool quiescence = (node->depth <= 0);  // are we in quiescence?
   result.should_enter_quiescence = quiescence;
   if (quiescence) {
@@ -251,17 +311,14 @@ leafEvalResult evaluate_as_leaf(searchNode *node, searchType_t type) {
   return result;
 }
 
-// Evaluate the move by performing a search.
-void evaluateMove(searchNode *node, move_t mv, move_t killer_a,
-                                  move_t killer_b, searchType_t type,
-                                  uint64_t *node_count_serial,
-                                  moveEvaluationResult *result) {
+// Search the child reached by mv, whose position has already been made.
+static void evaluate_made_move(searchNode *node, move_t mv, victims_t victims,
+                               move_t killer_a, move_t killer_b,
+                               searchType_t type, uint64_t *node_count_serial,
+                               moveEvaluationResult *result) {
   int ext = 0;  // extensions
   bool blunder = false;  // shoot our own piece
 
-  victims_t victims = make_move(&(node->position), &(result->next_node.position),
-                                mv);
-
   // Check whether this move changes the board state.
   //   such moves are not legal.
   if (is_KO(victims)) {
@@ -284,9 +341,9 @@ void evaluateMove(searchNode *node, move_t mv, move_t killer_a,
   }
 
   // Check whether the board state has been repeated, this results in a draw.
-  if (is_repeated(&(result->next_node.position), node->ply)) {
+  if (is_repeated(&(result->next_node.keys))) {
     result->type = MOVE_GAMEOVER;
-    result->score = get_draw_score(&(result->next_node.position), node->ply);
+    result->score = get_draw_score(&(result->next_node.keys), node->ply);
     return;
   }
 
@@ -347,7 +404,7 @@ void evaluateMove(searchNode *node, move_t mv, move_t killer_a,
   }
 
   // Check if we should abort due to time control.
-  if (abortf) {
+  if (should_abort()) {
     result->score = 0;
     result->type = MOVE_IGNORE;
     return;
@@ -371,6 +428,30 @@ void evaluateMove(searchNode *node, move_t mv, move_t killer_a,
   return;
 }
 
+// Evaluate the move by performing a search.  result->next_node.position must
+//   hold the node's position; the move is made on it in place and taken back
+//   before returning.
+void evaluateMove(searchNode *node, move_t mv, move_t killer_a,
+                                  move_t killer_b, searchType_t type,
+                                  uint64_t *node_count_serial,
+                                  moveEvaluationResult *result) {
+  position_t *p = result->next_node.position;
+  undo_t undo;
+
+  // The child probes the hash table first thing; fetch its set while the
+  // laser fires.
+  const uint64_t key = moved_key(p, mv);
+  tt_prefetch(key);
+  victims_t victims = do_move(p, mv, &undo);
+  tbassert(p->key == key || victims.zapped != 0, "moved_key() is wrong\n");
+  push_key(&(result->next_node.keys), p, &(node->keys));
+
+  evaluate_made_move(node, mv, victims, killer_a, killer_b, type,
+                     node_count_serial, result);
+
+  undo_move(p, &undo);
+}
+
 // Incremental sort of the move list.
 // This is the original implementation. This code just runs insertion sort on the different moves.
 void sort_incremental(sortable_move_t *move_list, int num_of_moves, int mv_index) {
@@ -402,78 +483,215 @@ void sort_incremental_new(sortable_move_t *move_list, int num_of_moves, int mv_i
   move_list[mv_index] = insert;
 }
 
+// Makes mv, which caused a cutoff at node, its first killer move.
+static void update_killers(searchNode *node, move_t mv) {
+  move_t *killer = tables_of(node->ctx)->killer;
+  if (mv != killer[KMT(node->ply, 0)] && ENABLE_TABLES) {
+    killer[KMT(node->ply, 1)] = killer[KMT(node->ply, 0)];
+    killer[KMT(node->ply, 0)] = mv;
+  }
+}
+
+// Makes mv followed by child_pv, if any, the line pv.  Lines end at the first
+// 0, and hold MAX_PLY_IN_SEARCH - 1 moves at most.
+static void set_pv(move_t *pv, move_t mv, const move_t *child_pv) {
+  pv[0] = mv;
+  int i = 0;
+  if (child_pv != NULL) {
+    for (; i < MAX_PLY_IN_SEARCH - 2 && child_pv[i] != 0; i++) {
+      pv[i + 1] = child_pv[i];
+    }
+  }
+  pv[i + 1] = 0;
+}
+
 // Returns true if a cutoff was triggered, false otherwise.
 bool search_process_score(searchNode *node, move_t mv, int mv_index,
                                 moveEvaluationResult *result, searchType_t type) {
   if (result->score > node->best_score) {
     node->best_score = result->score;
     node->best_move_index = mv_index;
-    node->subpv[0] = mv;
-
-    // write best move into right position in PV buffer.
-    memcpy(node->subpv + 1, result->next_node.subpv,
-           sizeof(move_t) * (MAX_PLY_IN_SEARCH - 1));
-    node->subpv[MAX_PLY_IN_SEARCH - 1] = 0;
+    node->best_move = mv;
+    if (node->pv != NULL) {
+      set_pv(node->pv, mv, result->next_node.pv);
+    }
 
     if (type != SEARCH_SCOUT && result->score > node->alpha) {
       node->alpha = result->score;
     }
 
     if (result->score >= node->beta) {
-      if (mv != killer[KMT(node->ply, 0)] && ENABLE_TABLES) {
-        killer[KMT(node->ply, 1)] = killer[KMT(node->ply, 0)];
-        killer[KMT(node->ply, 0)] = mv;
-      }
+      update_killers(node, mv);
       return true;
     }
   }
   return false;
 }
 
-// Check if we should abort.
-bool should_abort_check() {
-  tics++;
-  if ((tics & ABORT_CHECK_PERIOD) == 0) {
-    if (milliseconds() >= timeout) {
-      abortf = true;
-      return true;
+// Check if we should abort.  Without a watchdog thread, the clock is read
+// once every ABORT_CHECK_PERIOD + 1 calls.
+bool should_abort_check(searchContext *ctx) {
+  if (!watchdog_running) {
+    ctx->tics++;
+    if ((ctx->tics & ABORT_CHECK_PERIOD) == 0 && milliseconds() >= timeout) {
+      abort_search();
     }
   }
-  return false;
+  return should_abort();
 }
 
-// Obtain a sorted move list.
-static int get_sortable_move_list(searchNode *node, sortable_move_t * move_list,
-                         int hash_table_move) {
-  // number of moves in list
-
-  int num_of_moves = generate_all(&(node->position), move_list, false);
-  color_t fake_color_to_move = color_to_move_of(&(node->position));
+// History score of mv, used to order the moves within a stage.
+static sort_key_t history_score(const int *best_move_history, position_t *p,
+                                color_t fake_color_to_move, move_t mv) {
+  ptype_t  pce = ptype_mv_of(mv);
+  rot_t    ro  = rot_of(mv);   // rotation
+  square_t fs  = from_square(mv);
+  int      ot  = ORI_MASK & (ori_of(p->board[fs]) + ro);
+  square_t ts  = to_square(mv);
+  return best_move_history[BMH(fake_color_to_move, pce, ts, ot)];
+}
 
-  move_t killer_a = killer[KMT(node->ply, 0)];
-  move_t killer_b = killer[KMT(node->ply, 1)];
+// Staged move picker.  Hands out the moves of a node one at a time: the hash
+//   move, then the killers, then the moves that may capture, then the quiet
+//   ones, each stage ordered by the history table.  A stage is generated only
+//   when the one before it runs dry, so a cutoff saves generating and scoring
+//   the rest.  In quiescence the quiet stage is skipped altogether.
+//
+//   Moves handed out so far are move_list[0, next), in the order given, so
+//   that move_list can be passed to update_best_move_history().
+typedef enum {
+  PICK_HASH,
+  PICK_KILLER_A,
+  PICK_KILLER_B,
+  PICK_GEN_CAPTURES,
+  PICK_CAPTURES,
+  PICK_GEN_QUIETS,
+  PICK_QUIETS,
+  PICK_DONE
+} pickStage_t;
+
+typedef struct movePicker {
+  position_t *position;
+  pickStage_t stage;
+  bool captures_only;
+  move_t hash_move;
+  move_t killer_a;
+  move_t killer_b;
+  const int *best_move_history;
+  int num_special;   // hash move and killers handed out
+  int num_of_moves;  // moves in move_list
+  int next;          // moves handed out
+  sortable_move_t move_list[MAX_NUM_MOVES];
+} movePicker;
+
+static void init_move_picker(movePicker *mp, searchNode *node,
+                             move_t hash_table_move) {
+  mp->position = node->position;
+  mp->stage = PICK_HASH;
+  mp->captures_only = node->quiescence;
+  mp->hash_move = hash_table_move;
+  const searchTables *tables = tables_of(node->ctx);
+  mp->killer_a = tables->killer[KMT(node->ply, 0)];
+  mp->killer_b = tables->killer[KMT(node->ply, 1)];
+  mp->best_move_history = tables->best_move_history;
+  mp->num_special = 0;
+  mp->num_of_moves = 0;
+  mp->next = 0;
+}
 
-  // sort special moves to the front
-  for (int mv_index = 0; mv_index < num_of_moves; mv_index++) {
-    move_t mv = get_move(move_list[mv_index]);
-    if (mv == hash_table_move) {
-      set_sort_key(&move_list[mv_index], SORT_MASK);
-    } else if (mv == killer_a) {
-      set_sort_key(&move_list[mv_index], SORT_MASK - 1);
-    } else if (mv == killer_b) {
-      set_sort_key(&move_list[mv_index], SORT_MASK - 2);
-    } else {
-      ptype_t  pce = ptype_mv_of(mv);
-      rot_t    ro  = rot_of(mv);   // rotation
-      square_t fs  = from_square(mv);
-      int      ot  = ORI_MASK & (ori_of(node->position.board[fs]) + ro);
-      square_t ts  = to_square(mv);
-      set_sort_key(&move_list[mv_index],
-                   best_move_history[BMH(fake_color_to_move, pce, ts, ot)]);
+// Hands out mv ahead of the generated stages, if it is a move here and has
+//   not been handed out already.
+static bool pick_special(movePicker *mp, move_t mv) {
+  if (mv == 0 || !is_pseudo_legal(mp->position, mv) ||
+      (mp->captures_only && !may_capture(mp->position, mv))) {
+    return false;
+  }
+  for (int i = 0; i < mp->num_special; i++) {
+    if (get_move(mp->move_list[i]) == mv) {
+      return false;
     }
   }
+  tbassert(mp->next == mp->num_of_moves, "special moves come first\n");
+  mp->move_list[mp->num_of_moves++] = mv;
+  mp->num_special++;
+  mp->next++;
+  return true;
+}
 
-  return num_of_moves;
+// Appends the moves of the given kind, minus those already handed out.
+static void generate_stage(movePicker *mp, gen_kind_t kind) {
+  position_t *p = mp->position;
+  color_t fake_color_to_move = color_to_move_of(p);
+  sortable_move_t *lst = mp->move_list + mp->num_of_moves;
+  int n = generate_moves(p, lst, kind);
+
+  int kept = 0;
+  for (int i = 0; i < n; i++) {
+    move_t mv = get_move(lst[i]);
+    bool special = false;
+    for (int j = 0; j < mp->num_special; j++) {
+      special |= (get_move(mp->move_list[j]) == mv);
+    }
+    if (special) {
+      continue;
+    }
+    lst[kept] = mv;
+    set_sort_key(&lst[kept], history_score(mp->best_move_history, p,
+                                           fake_color_to_move, mv));
+    kept++;
+  }
+  mp->num_of_moves += kept;
 }
 
+// Returns the next move to search, or 0 when there are none left.
+static move_t next_move(movePicker *mp) {
+  while (true) {
+    switch (mp->stage) {
+      case PICK_HASH:
+        mp->stage = PICK_KILLER_A;
+        if (pick_special(mp, mp->hash_move)) {
+          return mp->hash_move;
+        }
+        break;
+      case PICK_KILLER_A:
+        mp->stage = PICK_KILLER_B;
+        if (pick_special(mp, mp->killer_a)) {
+          return mp->killer_a;
+        }
+        break;
+      case PICK_KILLER_B:
+        mp->stage = PICK_GEN_CAPTURES;
+        if (pick_special(mp, mp->killer_b)) {
+          return mp->killer_b;
+        }
+        break;
+      case PICK_GEN_CAPTURES:
+        generate_stage(mp, GEN_CAPTURES);
+        mp->stage = PICK_CAPTURES;
+        break;
+      case PICK_GEN_QUIETS:
+        generate_stage(mp, GEN_QUIETS);
+        mp->stage = PICK_QUIETS;
+        break;
+      case PICK_CAPTURES:
+      case PICK_QUIETS:
+        if (mp->next < mp->num_of_moves) {
+          sort_incremental_new(mp->move_list, mp->num_of_moves, mp->next);
+          return get_move(mp->move_list[mp->next++]);
+        }
+        mp->stage = (mp->stage == PICK_CAPTURES && !mp->captures_only)
+            ? PICK_GEN_QUIETS : PICK_DONE;
+        break;
+      case PICK_DONE:
+        return 0;
+    }
+  }
+}
 
+// Hands out all the remaining moves at once, for searching in parallel.
+//   Returns the total number of moves, all now in move_list in picking order.
+static int drain_move_picker(movePicker *mp) {
+  while (next_move(mp) != 0) {
+  }
+  return mp->next;
+}
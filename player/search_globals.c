@@ -1,25 +1,117 @@
 // Copyright (c) 2015 MIT License by 6.172 Staff
 
-#define __KMT_dim__ [MAX_PLY_IN_SEARCH*4]  // NOLINT(whitespace/braces)
+// Killer moves lookup function, into searchTables.killer
 #define KMT(ply, id) (4 * ply + id)
-static move_t killer __KMT_dim__;  // up to 4 killers
 
-// Best move history table and lookup function
+// Best move history lookup function, into searchTables.best_move_history
 // Format: best_move_history[color_t][piece_t][square_t][orientation]
-#define __BMH_dim__ [2*6*ARR_SIZE*NUM_ORI]  // NOLINT(whitespace/braces)
 #define BMH(color, piece, square, ori)                             \
     (color * 6 * ARR_SIZE * NUM_ORI + piece * ARR_SIZE * NUM_ORI + \
      square * NUM_ORI + ori)
+#define BMH_SIZE (2 * 6 * ARR_SIZE * NUM_ORI)
 
-static int best_move_history __BMH_dim__;
+// The Cilk search gives every worker thread its own tables, so that the
+// workers neither race on them nor share their cache lines, and merges them
+// at iteration boundaries (see merge_search_tables).  A thread claims its
+// tables the first time it searches in each search, so that threads gone
+// since, like the thread that ran an earlier "go", neither keep tables nor
+// have them merged.
+#define MAX_WORKERS 64
 
-void init_best_move_history() {
-  memset(best_move_history, 0, sizeof(best_move_history));
+static searchTables worker_tables[MAX_WORKERS];
+static int num_workers = 0;       // threads that have claimed tables
+static int max_num_workers = 0;   // in any search, so the tables in use
+static int tables_search = 0;     // counts the searches
+static __thread int worker_id = -1;
+static __thread int worker_search = -1;  // the search worker_id is of
+
+// Workers past MAX_WORKERS share the last tables.
+static searchTables *my_worker_tables() {
+  const int search = __atomic_load_n(&tables_search, __ATOMIC_RELAXED);
+  if (worker_search != search) {
+    worker_id = __sync_fetch_and_add(&num_workers, 1);
+    worker_search = search;
+  }
+  return &worker_tables[worker_id < MAX_WORKERS ? worker_id : MAX_WORKERS - 1];
+}
+
+static int num_worker_tables() {
+  return num_workers < MAX_WORKERS ? num_workers : MAX_WORKERS;
+}
+
+// The tables the calling thread orders its moves with.
+static inline searchTables *tables_of(searchContext *ctx) {
+  return ctx->serial ? &ctx->tables : my_worker_tables();
+}
+
+// Clears the history the tables of ctx have learned in earlier searches.
+// Killers carry over.
+static void clear_best_move_history(searchContext *ctx) {
+  if (ctx->serial) {
+    memset(ctx->tables.best_move_history, 0,
+           sizeof(ctx->tables.best_move_history));
+    return;
+  }
+  for (int w = 0; w < max_num_workers; w++) {
+    memset(worker_tables[w].best_move_history, 0,
+           sizeof(worker_tables[w].best_move_history));
+  }
+}
+
+// Has the threads of the next search claim their tables afresh.  Called
+// with no thread searching.
+static void reset_worker_tables() {
+  if (num_worker_tables() > max_num_workers) {
+    max_num_workers = num_worker_tables();
+  }
+  num_workers = 0;
+  __atomic_store_n(&tables_search, tables_search + 1, __ATOMIC_RELAXED);
+}
+
+// Merges the tables of the Cilk workers, between iterations and so with no
+// worker searching, if MERGE_TABLES is set.  Every worker gets the average
+// history of all of them, and for each ply the first two distinct killers
+// found going through the workers in order, first killers first.  The
+// result depends only on what the workers learned, not on timing.
+void merge_search_tables(searchContext *ctx) {
+  const int n = num_worker_tables();
+  if (ctx->serial || !MERGE_TABLES || n < 2) {
+    return;
+  }
+
+  for (int i = 0; i < BMH_SIZE; i++) {
+    int sum = 0;
+    for (int w = 0; w < n; w++) {
+      sum += worker_tables[w].best_move_history[i];
+    }
+    for (int w = 0; w < n; w++) {
+      worker_tables[w].best_move_history[i] = sum / n;
+    }
+  }
+
+  for (int ply = 0; ply < MAX_PLY_IN_SEARCH; ply++) {
+    move_t merged[2] = {0, 0};
+    int found = 0;
+    for (int id = 0; id < 2 && found < 2; id++) {
+      for (int w = 0; w < n && found < 2; w++) {
+        move_t mv = worker_tables[w].killer[KMT(ply, id)];
+        if (mv != 0 && (found == 0 || mv != merged[0])) {
+          merged[found++] = mv;
+        }
+      }
+    }
+    for (int w = 0; w < n; w++) {
+      worker_tables[w].killer[KMT(ply, 0)] = merged[0];
+      worker_tables[w].killer[KMT(ply, 1)] = merged[1];
+    }
+  }
 }
 
-static void update_best_move_history(position_t *p, int index_of_best,
+static void update_best_move_history(searchContext *ctx, position_t *p,
+                                     int index_of_best,
                                      sortable_move_t* lst, int count) {
   tbassert(ENABLE_TABLES, "Tables weren't enabled.\n");
+  int *best_move_history = tables_of(ctx)->best_move_history;
 
   int color_to_move = color_to_move_of(p);
 
@@ -47,24 +139,24 @@ static void update_best_move_history(position_t *p, int index_of_best,
 static void update_transposition_table(searchNode* node) {
   if (node->type == SEARCH_SCOUT) {
     if (node->best_score < node->beta) {
-      tt_hashtable_put(node->position.key, node->depth,
+      tt_hashtable_put(node->position->key, node->depth,
                        tt_adjust_score_for_hashtable(node->best_score, node->ply),
                        UPPER, 0);
     } else {
-      tt_hashtable_put(node->position.key, node->depth,
+      tt_hashtable_put(node->position->key, node->depth,
                        tt_adjust_score_for_hashtable(node->best_score, node->ply),
-                       LOWER, node->subpv[0]);
+                       LOWER, node->best_move);
     }
   } else if (node->type == SEARCH_PV) {
     if (node->best_score <= node->orig_alpha) {
-      tt_hashtable_put(node->position.key, node->depth,
+      tt_hashtable_put(node->position->key, node->depth,
           tt_adjust_score_for_hashtable(node->best_score, node->ply), UPPER, 0);
     } else if (node->best_score >= node->beta) {
-      tt_hashtable_put(node->position.key, node->depth,
-          tt_adjust_score_for_hashtable(node->best_score, node->ply), LOWER, node->subpv[0]);
+      tt_hashtable_put(node->position->key, node->depth,
+          tt_adjust_score_for_hashtable(node->best_score, node->ply), LOWER, node->best_move);
     } else {
-      tt_hashtable_put(node->position.key, node->depth,
-          tt_adjust_score_for_hashtable(node->best_score, node->ply), EXACT, node->subpv[0]);
+      tt_hashtable_put(node->position->key, node->depth,
+          tt_adjust_score_for_hashtable(node->best_score, node->ply), EXACT, node->best_move);
     }
   }
 }
@@ -11,24 +11,139 @@
 
 #define YOUNG_BROTHERS_WAIT 5
 
-// Checks whether a node's parent has aborted.
-//   If this occurs, we should just stop and return 0 immediately.
-bool parallel_parent_aborted(searchNode* node) {
-  searchNode* pred = node->parent;
-  while (pred != NULL) {
-    if (pred->abort) {
-      return true;
+// Checks whether split point sp has aborted.
+static inline bool split_aborted(const splitPoint *sp) {
+  return __atomic_load_n(&sp->abort, __ATOMIC_ACQUIRE);
+}
+
+// Checks whether a node's parent has aborted, that is whether its innermost
+//   split point has.  If this occurs, we should just stop and return 0
+//   immediately.
+static inline bool parallel_parent_aborted(const searchNode* node) {
+  return node->split != NULL && split_aborted(node->split);
+}
+
+// Makes sp the split point of node, whose remaining moves are about to be
+//   searched in parallel, and registers it with the split point above.
+static void open_split_point(splitPoint *sp, searchNode *node) {
+  sp->abort = 0;
+  sp->cutoff = false;
+  init_simple_mutex(&sp->lock);
+  sp->ctx = node->ctx;
+  sp->parent = node->split;
+  sp->children = NULL;
+  sp->prev = NULL;
+  node->child_split = sp;
+  __sync_fetch_and_add(&sp->ctx->splits, 1);
+
+  splitPoint *parent = sp->parent;
+  if (parent != NULL) {
+    simple_acquire(&parent->lock);
+    sp->next = parent->children;
+    if (sp->next != NULL) {
+      sp->next->prev = sp;
     }
-    pred = pred->parent;
+    parent->children = sp;
+    sp->abort = parent->abort;  // it may have aborted already
+    simple_release(&parent->lock);
+  } else {
+    sp->next = NULL;
   }
-  return false;
 }
 
-// Checks whether this node has aborted due to a cut-off.
-//   If this occurs, we should actually return the score.
-bool parallel_node_aborted(searchNode* node) {
-  if (node->abort) return true;
-  return false;
+// Unregisters sp once the moves of its node have all been searched.
+static void close_split_point(splitPoint *sp, searchNode *node) {
+  splitPoint *parent = sp->parent;
+  if (parent != NULL) {
+    simple_acquire(&parent->lock);
+    if (sp->prev != NULL) {
+      sp->prev->next = sp->next;
+    } else {
+      parent->children = sp->next;
+    }
+    if (sp->next != NULL) {
+      sp->next->prev = sp->prev;
+    }
+    simple_release(&parent->lock);
+  }
+  node->child_split = node->split;
+}
+
+// Aborts sp and every split point below it.  Locks are taken top down, and
+//   a split point only takes its parent's lock to (un)register, so this
+//   cannot deadlock.  Returns true for the call that did abort sp.
+static bool abort_split_point(splitPoint *sp, bool cutoff) {
+  bool aborted = false;
+  simple_acquire(&sp->lock);
+  if (!sp->abort) {
+    aborted = true;
+    sp->cutoff = cutoff;
+    __atomic_store_n(&sp->abort, 1, __ATOMIC_RELEASE);
+    __sync_fetch_and_add(&sp->ctx->aborts, 1);
+    for (splitPoint *child = sp->children; child != NULL;
+         child = child->next) {
+      abort_split_point(child, false);
+    }
+  }
+  simple_release(&sp->lock);
+  return aborted;
+}
+
+// A child of sp has finished, having searched nodes nodes.  Returns true if
+//   its result must be discarded because sp has aborted; its nodes count as
+//   wasted if the abort was a cutoff at sp (further up, they are counted as
+//   part of a bigger subtree).
+static bool split_child_discarded(splitPoint *sp, uint64_t nodes) {
+  if (!split_aborted(sp)) {
+    return false;
+  }
+  if (sp->cutoff) {
+    __sync_fetch_and_add(&sp->ctx->wasted_nodes, nodes);
+  }
+  return true;
+}
+
+// The best score found at a parallel scout node and the index of its move,
+//   packed into one word so that children can raise it with a compare and
+//   swap.  A bigger word is a better result: a higher score, or the same
+//   score from an earlier move, which is the one a serial search keeps.
+static inline uint32_t pack_best(score_t score, int mv_index) {
+  return ((uint32_t) (score - INT16_MIN) << 16) |
+      (uint16_t) (0xffff - mv_index);
+}
+
+static inline score_t best_score_of(uint32_t best) {
+  return (score_t) ((int) (best >> 16) + INT16_MIN);
+}
+
+static inline int best_index_of(uint32_t best) {
+  return 0xffff - (best & 0xffff);
+}
+
+// Offers the result of move mv, the mv_index-th, to the packed best word of
+//   a parallel scout node, without a lock.  Only a result that raises the
+//   word records its move (and line) in the node, under pv_mutex, and only if
+//   the word still holds it then; a better result may have come in
+//   meanwhile.
+static void offer_scout_score(searchNode *node, uint32_t *best,
+                              simple_mutex_t *pv_mutex, move_t mv,
+                              int mv_index, moveEvaluationResult *result) {
+  const uint32_t mine = pack_best(result->score, mv_index);
+  uint32_t seen = __atomic_load_n(best, __ATOMIC_RELAXED);
+  while (mine > seen) {
+    if (__atomic_compare_exchange_n(best, &seen, mine, false,
+                                    __ATOMIC_ACQ_REL, __ATOMIC_RELAXED)) {
+      simple_acquire(pv_mutex);
+      if (__atomic_load_n(best, __ATOMIC_ACQUIRE) == mine) {
+        node->best_move = mv;
+        if (node->pv != NULL) {
+          set_pv(node->pv, mv, NULL);
+        }
+      }
+      simple_release(pv_mutex);
+      return;
+    }
+  }
 }
 
 // Initialize a scout search node for a "Null Window" search.
@@ -36,17 +151,23 @@ bool parallel_node_aborted(searchNode* node) {
 //   https://chessprogramming.wikispaces.com/Null+Window
 static void initialize_scout_node(searchNode *node, const int depth) {
   node->type = SEARCH_SCOUT;
+  node->ctx = node->parent->ctx;
   node->beta = -(node->parent->alpha);
   node->alpha = node->beta - 1;
   node->depth = depth;
   node->ply = node->parent->ply + 1;
-  node->subpv[0] = 0;
+  node->best_move = 0;
+  if (node->pv != NULL) {
+    node->pv[0] = 0;
+  }
   node->legal_move_count = 0;
-  node->fake_color_to_move = color_to_move_of(&(node->position));
+  node->fake_color_to_move = color_to_move_of(node->position);
   // point of view = 1 for white, -1 for black
   node->pov = 1 - node->fake_color_to_move * 2;
   node->best_move_index = 0;  // index of best move found
   node->abort = false;
+  node->split = node->parent->child_split;
+  node->child_split = node->split;
 }
 
 static score_t scout_search(searchNode *node, const int depth,
@@ -56,7 +177,7 @@ static score_t scout_search(searchNode *node, const int depth,
   initialize_scout_node(node, depth);
 
   // check whether we should abort
-  if (should_abort_check() || parallel_parent_aborted(node)) {
+  if (should_abort_check(node->ctx) || parallel_parent_aborted(node)) {
     return 0;
   }
 
@@ -75,48 +196,27 @@ static score_t scout_search(searchNode *node, const int depth,
   node->quiescence = pre_evaluation_result.should_enter_quiescence;
 
   // Grab the killer-moves for later use.
-  const move_t killer_a = killer[KMT(node->ply, 0)];
-  const move_t killer_b = killer[KMT(node->ply, 1)];
+  const searchTables *tables = tables_of(node->ctx);
+  const move_t killer_a = tables->killer[KMT(node->ply, 0)];
+  const move_t killer_b = tables->killer[KMT(node->ply, 1)];
 
-  // Store the sorted move list on the stack.
-  //   MAX_NUM_MOVES is all that we need.
-  sortable_move_t move_list[MAX_NUM_MOVES];
-
-  // Obtain the sorted move list.
-  const int num_of_moves = get_sortable_move_list(node, move_list, hash_table_move);
-  
-  // For our parallel code we'll want to iterate over the first few values serially, then go parallel
-  // This variable sets how many nodes we'll search serially
-  // const int first_iteration_value = num_of_moves >= 5 ? 5 : num_of_moves;
+  // Moves are handed out lazily by the move picker (see search_common.c).
+  movePicker picker;
+  init_move_picker(&picker, node, hash_table_move);
 
   int number_of_moves_evaluated = 0;
 
-  // A simple mutex. See simple_mutex.h for implementation details.
-  simple_mutex_t node_mutex;
-  init_simple_mutex(&node_mutex);
-
-  // Sort the move list.
-  //  sort_incremental_new(move_list, num_of_moves, number_of_moves_evaluated);
-  
-  // This is the original code here, think it might be in place for parallelizing, so keeping it here
-  // but commented out for now
-
   moveEvaluationResult result;
-  result.next_node.subpv[0] = 0;
+  result.next_node.pv = NULL;  // scout nodes keep no lines
   result.next_node.parent = node;
+  result.next_node.position = node->position;  // moves are made in place
 
-  for (int mv_index = 0; mv_index < num_of_moves; mv_index++) {
-    // We have searched as many serial nodes as we need to. Break and start searching parallely
-    if (node->legal_move_count > YOUNG_BROTHERS_WAIT) {
-      break;
-    }
-
-    // Sort the move list.
-    sort_incremental_new(move_list, num_of_moves, number_of_moves_evaluated);
-    // Get the next move from the move list.
+  // Search the first few moves serially (young brothers wait), or all of
+  //   them in a serial search.
+  move_t mv;
+  while ((node->legal_move_count <= YOUNG_BROTHERS_WAIT || node->ctx->serial)
+         && (mv = next_move(&picker)) != 0) {
     int local_index = number_of_moves_evaluated++;
-    // Added this line to use our new incremental_sort implementation, wasn't originally here
-    move_t mv = get_move(move_list[local_index]);
 
     if (TRACE_MOVES) {
       print_move_info(mv, node->ply);
@@ -131,7 +231,7 @@ static score_t scout_search(searchNode *node, const int depth,
                  &result);
 
     if (result.type == MOVE_ILLEGAL || result.type == MOVE_IGNORE
-        || abortf || parallel_parent_aborted(node)) {
+        || should_abort() || parallel_parent_aborted(node)) {
       continue;
     }
 
@@ -160,35 +260,52 @@ static score_t scout_search(searchNode *node, const int depth,
 
   int start_value = number_of_moves_evaluated;
 
-  sort_incremental(move_list, num_of_moves, number_of_moves_evaluated);
-  
+  // The rest of the moves are searched in parallel, so take them all now.
+  const int num_of_moves = drain_move_picker(&picker);
+  sortable_move_t *move_list = picker.move_list;
+
+  if (start_value < num_of_moves) {
+  splitPoint sp;
+  open_split_point(&sp, node);
+
+  // The children merge their results into best, and only the ones that
+  // raise it take pv_mutex to copy their PV (a simple mutex, see
+  // simple_mutex.h).
+  uint32_t best = pack_best(node->best_score, node->best_move_index);
+  simple_mutex_t pv_mutex;
+  init_simple_mutex(&pv_mutex);
+
   cilk_for (int mv_index = start_value; mv_index < num_of_moves; mv_index++) {
     do {
-      if (node->abort) continue;
+      if (split_aborted(&sp)) continue;
       // Get the next move from the move list.
       int local_index = __sync_fetch_and_add(&number_of_moves_evaluated, 1);
-      // Added this line to use our new incremental_sort implementation, wasn't originally here
-      // sort_incremental_new(move_list, num_of_moves, local_index);
       move_t mv = get_move(move_list[local_index]);
 
       if (TRACE_MOVES) {
         print_move_info(mv, node->ply);
       }
 
-      // increase node count
-      __sync_fetch_and_add(node_count_serial, 1);
+      // The child counts its nodes on its own, so that it can tell how
+      // many were wasted if a cutoff discards it.
+      uint64_t child_nodes = 1;
+
+      // Siblings run in parallel, so each one works on its own copy.
+      position_t position = *(node->position);
 
       moveEvaluationResult result;
-      result.next_node.subpv[0] = 0;
+      result.next_node.pv = NULL;  // scout nodes keep no lines
       result.next_node.parent = node;
+      result.next_node.position = &position;
 
       evaluateMove(node, mv, killer_a, killer_b,
                             SEARCH_SCOUT,
-                            node_count_serial,
+                            &child_nodes,
                             &result);
+      __sync_fetch_and_add(node_count_serial, child_nodes);
 
       if (result.type == MOVE_ILLEGAL || result.type == MOVE_IGNORE
-          || abortf || parallel_parent_aborted(node)) {
+          || should_abort() || split_child_discarded(&sp, child_nodes)) {
         continue;
       }
 
@@ -199,17 +316,24 @@ static score_t scout_search(searchNode *node, const int depth,
         __sync_fetch_and_add(&node->legal_move_count, 1); 
       }
 
-      // process the score. Note that this mutates fields in node.
-      simple_acquire(&node_mutex);
-      bool cutoff = search_process_score(node, mv, local_index, &result, SEARCH_SCOUT);
-      simple_release(&node_mutex);
-      if (cutoff) {
+      // process the score.  The first cutoff aborts the siblings and alone
+      // updates the killers.
+      offer_scout_score(node, &best, &pv_mutex, mv, local_index, &result);
+      if (result.score >= node->beta) {
         node->abort = true;
+        if (abort_split_point(&sp, true)) {
+          update_killers(node, mv);
+        }
         continue;
       }
     } while (false);
   }
 
+  close_split_point(&sp, node);
+  node->best_score = best_score_of(best);
+  node->best_move_index = best_index_of(best);
+  }
+
   }
 
   if (parallel_parent_aborted(node)) {
@@ -217,14 +341,14 @@ static score_t scout_search(searchNode *node, const int depth,
   }
 
   if (node->quiescence == false) {
-    update_best_move_history(&(node->position), node->best_move_index,
-                             move_list, number_of_moves_evaluated);
+    update_best_move_history(node->ctx, node->position, node->best_move_index,
+                             picker.move_list, number_of_moves_evaluated);
   }
 
   tbassert(abs(node->best_score) != -INF, "best_score = %d\n",
            node->best_score);
 
-  // Reads node->position.key, node->depth, node->best_score, and node->ply
+  // Reads node->position->key, node->depth, node->best_score, and node->ply
   update_transposition_table(node);
 
   return node->best_score;
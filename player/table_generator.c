@@ -1,39 +1,41 @@
+// Copyright (c) 2015 MIT License by 6.172 Staff
+
+// Writes precomp_tables.h, the lookup tables that depend on the board
+// geometry, to standard output.  The Makefile builds and runs this for the
+// BOARD_WIDTH being built; the geometry below must match move_gen.h.
+
+#include <stdbool.h>
 #include <stdint.h>
 #include <stdlib.h>
 #include <stdio.h>
 #include <math.h>
 
-#define __STDC_FORMAT_MACROS
-#include <inttypes.h>
-
+#ifndef BOARD_WIDTH
 #define BOARD_WIDTH 10
+#endif
+#if BOARD_WIDTH == 10
+#define BOARD_ORIGIN 3
+#elif BOARD_WIDTH == 8
+#define BOARD_ORIGIN 1
+#else
+#error "BOARD_WIDTH must be 8 or 10"
+#endif
+
 #define ARR_WIDTH 16
-#define FIL_ORIGIN ((ARR_WIDTH - BOARD_WIDTH) / 2)
+#define ARR_SIZE (ARR_WIDTH * (BOARD_WIDTH + 2 * BOARD_ORIGIN))
+#define FIL_ORIGIN BOARD_ORIGIN
+#define RNK_ORIGIN BOARD_ORIGIN
 #define FIL_SHIFT 4
 #define FIL_MASK 15
-#define RNK_ORIGIN ((ARR_WIDTH - BOARD_WIDTH) / 2)
 #define RNK_SHIFT 0
 #define RNK_MASK 15
+#define BB_SQUARES (BOARD_WIDTH * BOARD_WIDTH)
 
 #define PIECE_SIZE 5  // Number of bits in (ptype, color, orientation)
-
-// MOVE_MASK is 20 bits
-#define MOVE_MASK 0xfffff
-
-#define PTYPE_MV_SHIFT 18
-#define PTYPE_MV_MASK 3
-#define FROM_SHIFT 8
-#define FROM_MASK 0xFF
-#define TO_SHIFT 0
-#define TO_MASK 0xFF
-#define ROT_SHIFT 16
-#define ROT_MASK 3
-
 #define PTYPE_SHIFT 2
 #define PTYPE_MASK 3
-
-typedef int32_t ev_score_t;  // Static evaluator uses "hi res" values
-int PCENTRAL;
+#define COLOR_SHIFT 4
+#define COLOR_MASK 1
 
 typedef enum {
   EMPTY,
@@ -42,152 +44,137 @@ typedef enum {
   INVALID
 } ptype_t;
 
-typedef int fil_t;
-typedef int rnk_t;
-typedef int square_t;
-
 // Finds file of square
-fil_t fil_of(square_t sq) {
-  fil_t f = ((sq >> FIL_SHIFT) & FIL_MASK) - FIL_ORIGIN;
-  return f;
+int fil_of(int sq) {
+  return ((sq >> FIL_SHIFT) & FIL_MASK) - FIL_ORIGIN;
 }
 
 // Finds rank of square
-rnk_t rnk_of(square_t sq) {
-  rnk_t r = ((sq >> RNK_SHIFT) & RNK_MASK) - RNK_ORIGIN;
-  return r;
+int rnk_of(int sq) {
+  return ((sq >> RNK_SHIFT) & RNK_MASK) - RNK_ORIGIN;
 }
 
-// Harmonic-ish distance: 1/(|dx|+1) + 1/(|dy|+1)
-float h_dist(square_t a, square_t b) {
-  //  printf("a = %d, FIL(a) = %d, RNK(a) = %d\n", a, FIL(a), RNK(a));
-  //  printf("b = %d, FIL(b) = %d, RNK(b) = %d\n", b, FIL(b), RNK(b));
-  int delta_fil = abs(fil_of(a) - fil_of(b));
-  int delta_rnk = abs(rnk_of(a) - rnk_of(b));
-  float x = (1.0 / (delta_fil + 1)) + (1.0 / (delta_rnk + 1));
-  //  printf("max_dist = %d\n\n", x);
-  return x;
+// For no square, use 0, which is guaranteed to be off board
+int square_of(int f, int r) {
+  return ARR_WIDTH * (FIL_ORIGIN + f) + RNK_ORIGIN + r;
 }
 
-// For no square, use 0, which is guaranteed to be off board
-square_t square_of(fil_t f, rnk_t r) {
-  square_t s = ARR_WIDTH * (FIL_ORIGIN + f) + RNK_ORIGIN + r;
-  return s;
+bool on_board(int sq) {
+  return fil_of(sq) >= 0 && fil_of(sq) < BOARD_WIDTH &&
+      rnk_of(sq) >= 0 && rnk_of(sq) < BOARD_WIDTH;
+}
+
+// PCENTRAL heuristic: Bonus for Pawn near center of board.  Written the way
+// eval.c used to compute it, so that the table is bit for bit the same.
+double pcentral(int f, int r) {
+  int df = BOARD_WIDTH/2 - f - 1;
+  if (df < 0)  df = f - BOARD_WIDTH/2;
+  int dr = BOARD_WIDTH/2 - r - 1;
+  if (dr < 0) dr = r - BOARD_WIDTH/2;
+  return 1 - sqrt(df * df + dr * dr) * sqrt(2) / BOARD_WIDTH;
+}
+
+// Catch a header left over from a build for another board width.
+void generate_geometry_check() {
+  printf("#if BOARD_WIDTH != %d || ARR_SIZE != %d\n", BOARD_WIDTH, ARR_SIZE);
+  printf("#error \"precomp_tables.h is for another board width; make clean\"\n");
+  printf("#endif\n\n");
 }
 
-// Using our valid square_of method, generate a table that precomputes these values
-void generate_square_table() {
-  FILE *fp = fopen("square_of_table.c", "wb");
-  int x;
-  int y;
-  fprintf(fp, "static const unsigned char square_of_table[13][15] = {\n");
-  for (x = 0; x < 13; x++) {
-    fprintf(fp, "{");
-    for (y = 0; y < 15; y++) {
-      if (square_of(x-3, y-3) < 0) {
-        fprintf(fp, "-'\\x%1x', ", -square_of(x-3,y-3));
-      } else {
-        fprintf(fp, "'\\x%1x', ", square_of(x-3,y-3));
+// The eight King and pawn moves, and the beam directions NN, EE, SS, WW.
+void generate_directions() {
+  printf("// direction map\n");
+  printf("static const int8_t dir_table[8] = {\n ");
+  for (int df = -1; df <= 1; df++) {
+    for (int dr = -1; dr <= 1; dr++) {
+      if (df != 0 || dr != 0) {
+        printf(" %d,", df * ARR_WIDTH + dr);
       }
     }
-    fprintf(fp, "},\n");
   }
-  fprintf(fp, "};");
-};
-
-// Using our valid h_dist method, generate a file that is formatted as a precomputed table for these values
-void generate_h_dist_table() {
-  FILE *fp = fopen("h_dist_table.c", "wb");
-  int x;
-  int y;
-  fprintf(fp, "static const float h_dist_table[216][216] = {\n");
-  for (x = 0; x < 216; x++) {
-    fprintf(fp, "{");
-    for (y = 0; y < 216; y++) {
-      fprintf(fp, "%f, ", h_dist(x, y));
-    }
-    fprintf(fp, "},\n");
-  }
-  fprintf(fp, "};");
-  fclose(fp);
-};
-
-// Using our valid fil_of method, generate a file that is formatted as a precomputed table for these values
-void generate_fil_table(){
-  FILE *fp = fopen("fil_table.c", "wb");
-  int x;
-  fprintf(fp, "static const unsigned int fil_table[216] = {\n");
-  for (x = 0; x < 216; x++) {
-    if (fil_of((square_t)x) < 0) {
-      fprintf(fp, "-%d, ", -(int)fil_of((square_t)x));
-    } else {
-      fprintf(fp, "%d, ", (int)fil_of((square_t)x));
-    }
-    if ((x + 1) % 16 == 0) {
-      fprintf(fp, "\n");
-    }
-  }
-  fprintf(fp, "};");
-  fclose(fp);
-};
-
-// Using our valid rnk_of method, generate a file that is formatted as a precomputed table for these values
-void generate_rnk_table() {
-  FILE *fp = fopen("rnk_table.c", "wb");
-  int x;
-  fprintf(fp, "static const unsigned int rnk_table[216] = {\n");
-  for (x = 0; x < 216; x++) {
-    fprintf(fp, "%d, ", (int)rnk_of((square_t)x));
-    if ((x + 1) % 16 == 0) {
-      fprintf(fp, "\n");
-    }
-  }
-  fprintf(fp, "};");
-  fclose(fp);
-};
+  printf("\n};\n\n");
 
+  printf("// directions for laser: NN, EE, SS, WW\n");
+  printf("static const int8_t beam_table[4] = {%d, %d, %d, %d};\n\n",
+         1, ARR_WIDTH, -1, -ARR_WIDTH);
+}
 
-// PCENTRAL heuristic: Bonus for Pawn near center of board
-double pcentral(fil_t f, rnk_t r) {
-  double df = BOARD_WIDTH/2 - f - 1;
-  if (df < 0)  df = f - BOARD_WIDTH/2;
-  double dr = BOARD_WIDTH/2 - r - 1;
-  if (dr < 0) dr = r - BOARD_WIDTH/2;
-  double bonus = 1 - sqrt(df * df + dr * dr) / (BOARD_WIDTH / sqrt(2));
-//  printf("%lf\n", bonus);
+// Square <-> bitboard bit maps; off-board squares map to bit 0xff.
+void generate_square_maps() {
+  printf("// bit_of_table[sq]: bit of square sq, file-major\n");
+  printf("static const uint8_t bit_of_table[%d] = {", ARR_SIZE);
+  for (int sq = 0; sq < ARR_SIZE; sq++) {
+    printf("%s%d,", sq % ARR_WIDTH ? " " : "\n  ",
+           on_board(sq) ? fil_of(sq) * BOARD_WIDTH + rnk_of(sq) : 0xff);
+  }
+  printf("\n};\n\n");
 
-//  printf("Pcentral = %lf", PCENTRAL);
-  return bonus;
+  printf("// square_of_bit_table[b]: inverse of bit_of_table\n");
+  printf("static const uint8_t square_of_bit_table[%d] = {", BB_SQUARES);
+  for (int b = 0; b < BB_SQUARES; b++) {
+    printf("%s%d,", b % BOARD_WIDTH ? " " : "\n  ",
+           square_of(b / BOARD_WIDTH, b % BOARD_WIDTH));
+  }
+  printf("\n};\n\n");
 }
 
-// Using our valid pcentral method, generate a file that is formatted as a precomputed table for these values
-void generate_pcentral(){
-  FILE *fp = fopen("pcentral_table.c", "wb");
-  int x;
-  int y;
-  fprintf(fp, "static const int pcentral_table[13][15] = {\n");
-  for (x = 0; x < 16; x++) {
-    fprintf(fp, "{");
-    for (y = 0; y < 16; y++) {
-//      if (square_of(x-3, y-3) < 0) {
-//        fprintf(fp, "PRIu32, ", (uint32_t)-pcentral(x-3,y-3));
-//      } else {
-        printf("%lf", pcentral((fil_t)x,(rnk_t)y));
-        fprintf(fp, "%lf, ", pcentral((fil_t)x,(rnk_t)y));
-//      }
+void generate_pcentral() {
+  printf("// pcentral_table[f][r]: PCENTRAL bonus fraction for a pawn on (f, r)\n");
+  printf("static const double pcentral_table[%d][%d] = {\n",
+         BOARD_WIDTH, BOARD_WIDTH);
+  for (int f = 0; f < BOARD_WIDTH; f++) {
+    printf("  {");
+    for (int r = 0; r < BOARD_WIDTH; r++) {
+      printf("%s%.17g", r ? ", " : "", pcentral(f, r));
     }
-    fprintf(fp, "},\n");
+    printf("},\n");
   }
-  fprintf(fp, "};");
+  printf("};\n\n");
 }
 
+// The pieces a move may land on: a pawn may move onto an empty square or
+// stomp an enemy pawn, and a King only moves onto empty squares.  Indexed by
+// the moving piece and then by the destination's contents; off-board squares
+// hold INVALID, so they need no check of their own.
+void generate_dest_legal_table() {
+  printf("// dest_legal_table[mover][contents of the destination square]: may the\n");
+  printf("// piece mover move onto that square?\n");
+  printf("static const bool dest_legal_table[%d][%d] = {\n",
+         1 << PIECE_SIZE, 1 << PIECE_SIZE);
+  for (int x = 0; x < (1 << PIECE_SIZE); x++) {
+    printf("{");
+    for (int y = 0; y < (1 << PIECE_SIZE); y++) {
+      const int xt = (x >> PTYPE_SHIFT) & PTYPE_MASK;
+      const int yt = (y >> PTYPE_SHIFT) & PTYPE_MASK;
+      const int xc = (x >> COLOR_SHIFT) & COLOR_MASK;
+      const int yc = (y >> COLOR_SHIFT) & COLOR_MASK;
+      int legal = 0;
+      if (xt == PAWN) {
+        legal = yt == EMPTY || (yt == PAWN && yc != xc);
+      } else if (xt == KING) {
+        legal = yt == EMPTY;
+      }
+      printf("%d,", legal);
+    }
+    printf("},\n");
+  }
+  printf("};\n\n");
+}
 
 int main() {
-//   generate_h_dist_table();
-//  generate_fil_table();
-//  generate_rnk_table();
-//  generate_square_table();
+  printf("// Generated by table_generator.c for BOARD_WIDTH %d; do not edit.\n\n",
+         BOARD_WIDTH);
+  printf("#ifndef PRECOMP_TABLES_H\n");
+  printf("#define PRECOMP_TABLES_H\n\n");
+  printf("#include <stdbool.h>\n");
+  printf("#include <stdint.h>\n\n");
+
+  generate_geometry_check();
+  generate_directions();
+  generate_square_maps();
   generate_pcentral();
+  generate_dest_legal_table();
 
+  printf("#endif  // PRECOMP_TABLES_H\n");
   return 0;
 }
@@ -0,0 +1,102 @@
+// Copyright (c) 2015 MIT License by 6.172 Staff
+
+#include "./timeman.h"
+
+#include "./util.h"
+
+// Iterations are predicted to cost the last one times the effective
+// branching factor, the average ratio of the nodes of an iteration to those
+// of the one before.  An iteration may be started if it is predicted to end
+// within TM_OVERRUN times the scaled goal; until the branching factor is
+// known, only if less than TM_RATIO of the scaled goal has gone.
+#define TM_OVERRUN 2.0
+#define TM_RATIO 0.5
+#define TM_MAX_EBF 20.0
+
+// Each change of the best move stretches the goal by TM_CHANGE_STRETCH,
+// decaying by TM_CHANGE_DECAY an iteration.  A score dropping by
+// TM_SCORE_DROP or more stretches it by TM_DROP_STRETCH, and a best move
+// taking TM_DOMINANT_SHARE of the nodes cuts it by TM_DOMINANT_CUT.
+#define TM_CHANGE_STRETCH 0.5
+#define TM_CHANGE_DECAY 0.5
+#define TM_SCORE_DROP (PAWN_VALUE / 4)
+#define TM_DROP_STRETCH 1.5
+#define TM_DOMINANT_SHARE 0.9
+#define TM_DOMINANT_CUT 0.5
+#define TM_MIN_SCALE 0.25
+#define TM_MAX_SCALE 1.5  // so that TM_OVERRUN * goal * scale <= 3 * goal
+
+// The goal when the clock is not given, in milliseconds.
+#define TM_DEFAULT_GOAL 1000.0
+
+double tm_goal(double time_left, double inc) {
+  if (time_left <= 0 && inc <= 0) {
+    return TM_DEFAULT_GOAL;  // "go" without a clock
+  }
+  double goal = time_left * 0.02;  // use about 1/50 of main time
+  goal += inc * 0.80;              // use most of increment
+  // sanity check for very small times
+  if (goal * 10 > time_left) {
+    goal = time_left / 10.0;
+  }
+  return goal;
+}
+
+void tm_start(timeManager *tm, double goal) {
+  tm->goal = goal;
+  tm->scale = 1.0;
+  tm->instability = 0.0;
+  tm->iter_start = milliseconds();
+  tm->iter_time = 0.0;
+  tm->iter_nodes = 0;
+  tm->ebf = 0.0;
+  tm->iterations = 0;
+  tm->best_move = 0;
+  tm->score = 0;
+}
+
+void tm_iteration_done(timeManager *tm, uint64_t nodes,
+                       uint64_t best_move_nodes, move_t best_move,
+                       score_t score) {
+  const double now = milliseconds();
+  tm->iter_time = now - tm->iter_start;
+  tm->iter_start = now;
+
+  if (tm->iter_nodes > 0 && nodes > 0) {
+    double b = (double) nodes / tm->iter_nodes;
+    if (b < 1.0) b = 1.0;
+    if (b > TM_MAX_EBF) b = TM_MAX_EBF;
+    tm->ebf = tm->ebf > 0 ? (tm->ebf + b) / 2 : b;
+  }
+  tm->iter_nodes = nodes;
+
+  tm->instability *= TM_CHANGE_DECAY;
+  if (tm->iterations > 0 && best_move != tm->best_move) {
+    tm->instability += 1.0;
+  }
+  double scale = 1.0 + TM_CHANGE_STRETCH * tm->instability;
+  if (tm->iterations > 0 && score <= tm->score - TM_SCORE_DROP) {
+    scale *= TM_DROP_STRETCH;
+  }
+  if (nodes > 0 && best_move_nodes >= TM_DOMINANT_SHARE * nodes) {
+    scale *= TM_DOMINANT_CUT;
+  }
+  if (scale < TM_MIN_SCALE) scale = TM_MIN_SCALE;
+  if (scale > TM_MAX_SCALE) scale = TM_MAX_SCALE;
+  tm->scale = scale;
+
+  tm->best_move = best_move;
+  tm->score = score;
+  tm->iterations++;
+}
+
+bool tm_should_stop(const timeManager *tm, double elapsed) {
+  const double target = tm->goal * tm->scale;
+  if (elapsed >= target) {
+    return true;
+  }
+  if (tm->ebf > 0) {
+    return elapsed + tm->iter_time * tm->ebf > target * TM_OVERRUN;
+  }
+  return elapsed > target * TM_RATIO;
+}
@@ -0,0 +1,51 @@
+// Copyright (c) 2015 MIT License by 6.172 Staff
+
+// Time management: how long to think about a move, and whether to start
+// another iteration of the iterative deepening.
+
+#ifndef TIMEMAN_H
+#define TIMEMAN_H
+
+#include <inttypes.h>
+#include <stdbool.h>
+
+#include "./move_gen.h"
+#include "./search.h"
+
+// The time manager of one search.  The goal is the time the move should
+// take on average; it is stretched while the best move keeps changing or
+// the score drops, and cut short when the best move takes nearly all the
+// nodes.  The search is never allowed more than 3 times the goal (see
+// init_abort_timer).
+typedef struct timeManager {
+  double   goal;          // nominal time for the move, in milliseconds
+  double   scale;         // of the goal, for how hard the position looks
+  double   instability;   // decaying count of best move changes
+  double   iter_start;    // milliseconds() at the start of the iteration
+  double   iter_time;     // time the last iteration took
+  uint64_t iter_nodes;    // nodes the last iteration searched
+  double   ebf;           // effective branching factor, 0 if not known yet
+  int      iterations;    // completed
+  move_t   best_move;     // of the last iteration
+  score_t  score;         // of the last iteration
+} timeManager;
+
+// The goal for a move, given the time left on the clock and the increment,
+// both in milliseconds; a second if neither is given.
+double tm_goal(double time_left, double inc);
+
+// Starts managing a search of the given goal time.
+void tm_start(timeManager *tm, double goal);
+
+// Takes note of an iteration that completed with the given best move and
+// score, after searching nodes nodes, best_move_nodes of them below the best
+// move.
+void tm_iteration_done(timeManager *tm, uint64_t nodes,
+                       uint64_t best_move_nodes, move_t best_move,
+                       score_t score);
+
+// Whether to stop rather than start another iteration, elapsed
+// milliseconds into the search.
+bool tm_should_stop(const timeManager *tm, double elapsed);
+
+#endif  // TIMEMAN_H
@@ -4,32 +4,93 @@
 
 #include "./tt.h"
 
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
 #include <stdlib.h>
 #include <stdio.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 #include "./tbassert.h"
 
 int HASH;     // hash table size in MBytes
 int USE_TT;   // Use the transposition table.
 // Turn off for deterministic behavior of the search.
 
-// the actual record that holds the data for the transposition
-// typedef to be ttRec_t in tt.h
-struct ttRec {
-  uint64_t  key;
-  move_t    move;
-  score_t   score;
-  int       quality;
-  ttBound_t bound;
-  int       age;
-};
-
-
-// each set is a 4-way set-associative cache and contains 4 records
-#define RECORDS_PER_SET 1
+// A record is two words, the key and the data packed below.  Records that
+// have never been written are all zero.
+//
+// All the search threads read and write the table without locks.  In the
+// table, the key word holds key ^ data, so a record torn by writes racing
+// each other, its key word from one write and its data from another, does
+// not match its key and reads as a miss.  The words are read and written
+// atomically, each on its own.
+
+// Layout of ttRec.data, from the low bits up: move, score, depth (the
+// quality of the score, a signed byte), bound and age.
+#define TT_MOVE_BITS 20
+#define TT_SCORE_SHIFT 20
+#define TT_DEPTH_SHIFT 36
+#define TT_BOUND_SHIFT 44
+#define TT_AGE_SHIFT 46
+#define TT_AGE_MASK 0x3f
+
+// Each set is a 4-way set-associative bucket of 64 bytes, one cache line.
+#define RECORDS_PER_SET 4
+#define TT_SET_ALIGN 64
 typedef struct {
   ttRec_t records[RECORDS_PER_SET];
 } ttSet_t;
 
+// How many depths a search of age counts for when choosing which record of a
+// full set to replace: the one with the least depth - TT_AGE_WEIGHT * age,
+// age being how many searches ago it was written.
+#define TT_AGE_WEIGHT 4
+
+
+// The table is mapped on huge pages when the system has them, as probes go
+// all over it and would otherwise miss the TLB nearly every time.
+#define TT_HUGE_PAGE (2ULL << 20)
+
+// How the memory of the table was got, from best to worst.
+typedef enum {
+  TT_HUGETLB,   // mapped on reserved huge pages
+  TT_THP,       // mapped, with transparent huge pages advised
+  TT_MMAP,      // mapped on normal pages
+  TT_MALLOC,    // allocated
+  TT_FILE       // mapped on a file, by tt_map_hashtable_file()
+} ttBacking_t;
+
+static const char *backing_names[] = {
+  "huge pages", "transparent huge pages", "normal pages", "malloc", "file"
+};
+
+// A hash table file is a header of TT_FILE_HEADER bytes, one page, followed
+// by the sets just as they are in memory, so that the file can be mapped as
+// the table (the key words holding key ^ data, in the byte order of the
+// machine).  A table is only taken from a file written by an engine with the
+// same board, records and Zobrist keys.
+#define TT_FILE_MAGIC "LCHTABLE"
+#define TT_FILE_VERSION 1
+#define TT_FILE_HEADER 4096
+typedef struct {
+  char     magic[8];
+  uint32_t version;
+  uint32_t board_width;
+  uint64_t zobrist;           // zob_signature() of the engine
+  uint64_t num_of_sets;
+  uint32_t records_per_set;
+  uint32_t bytes_per_record;
+  uint32_t age;               // of the table when it was written
+} ttFileHeader;
+
+// The table is cleared by up to TT_MAX_CLEAR_THREADS threads, one for every
+// TT_CLEAR_PER_THREAD bytes, each clearing every nth huge page.  The first
+// thread to touch a page places it on its NUMA node, so the table ends up
+// interleaved over the nodes the threads ran on.
+#define TT_MAX_CLEAR_THREADS 64
+#define TT_CLEAR_PER_THREAD (64ULL << 20)
 
 // struct def for the global transposition table
 struct ttHashtable {
@@ -37,17 +98,46 @@ struct ttHashtable {
   uint64_t mask;           // a mask to map from key to set index
   unsigned age;
   ttSet_t *tt_set;         // array of sets that contains the transposition
+  size_t mapped_bytes;     // size of the memory of tt_set
+  ttBacking_t backing;     // and where it came from
+  ttFileHeader *header;    // of the file the table is mapped on, if any
+  dev_t file_dev;          // and which file that is
+  ino_t file_ino;
 } hashtable;  // name of the global transposition table
 
 
+static uint64_t pack_data(move_t move, score_t score, int depth,
+                          ttBound_t bound, unsigned age) {
+  if (depth > INT8_MAX) depth = INT8_MAX;
+  if (depth < INT8_MIN) depth = INT8_MIN;
+  return (uint64_t) (move & MOVE_MASK)
+      | (uint64_t) (uint16_t) score << TT_SCORE_SHIFT
+      | (uint64_t) (uint8_t) depth << TT_DEPTH_SHIFT
+      | (uint64_t) bound << TT_BOUND_SHIFT
+      | (uint64_t) (age & TT_AGE_MASK) << TT_AGE_SHIFT;
+}
+
+static int depth_of(const ttRec_t *rec) {
+  return (int8_t) (rec->data >> TT_DEPTH_SHIFT);
+}
+
+static ttBound_t bound_of(const ttRec_t *rec) {
+  return (ttBound_t) ((rec->data >> TT_BOUND_SHIFT) & 3);
+}
+
+// How many searches ago rec was written, modulo 64.
+static unsigned age_of(const ttRec_t *rec) {
+  return (hashtable.age - (unsigned) (rec->data >> TT_AGE_SHIFT)) & TT_AGE_MASK;
+}
+
 // getting the move out of the record
 move_t tt_move_of(ttRec_t *rec) {
-  return rec->move;
+  return rec->data & MOVE_MASK;
 }
 
 // getting the score out of the record
 score_t tt_score_of(ttRec_t *rec) {
-  return rec->score;
+  return (score_t) (uint16_t) (rec->data >> TT_SCORE_SHIFT);
 }
 
 size_t tt_get_bytes_per_record() {
@@ -58,7 +148,129 @@ uint32_t tt_get_num_of_records() {
   return hashtable.num_of_sets * RECORDS_PER_SET;
 }
 
-void tt_resize_hashtable(int size_in_meg) {
+// Gets bytes of memory for the table, 64-byte aligned, trying huge pages
+// first.  Returns NULL if there is no memory at all.
+static ttSet_t *map_table(size_t bytes) {
+  void *mem;
+  // Huge page mappings must be a whole number of huge pages.
+  const size_t huge_bytes = (bytes + TT_HUGE_PAGE - 1) & ~(TT_HUGE_PAGE - 1);
+
+#ifdef MAP_HUGETLB
+  mem = mmap(NULL, huge_bytes, PROT_READ | PROT_WRITE,
+             MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+  if (mem != MAP_FAILED) {
+    hashtable.mapped_bytes = huge_bytes;
+    hashtable.backing = TT_HUGETLB;
+    return (ttSet_t *) mem;
+  }
+#endif
+
+  mem = mmap(NULL, huge_bytes, PROT_READ | PROT_WRITE,
+             MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (mem != MAP_FAILED) {
+    hashtable.mapped_bytes = huge_bytes;
+    hashtable.backing = TT_MMAP;
+#ifdef MADV_HUGEPAGE
+    if (madvise(mem, huge_bytes, MADV_HUGEPAGE) == 0) {
+      hashtable.backing = TT_THP;
+    }
+#endif
+    return (ttSet_t *) mem;
+  }
+
+  if (posix_memalign(&mem, TT_SET_ALIGN, bytes) == 0) {
+    hashtable.mapped_bytes = bytes;
+    hashtable.backing = TT_MALLOC;
+    return (ttSet_t *) mem;
+  }
+  return NULL;
+}
+
+static void unmap_table() {
+  if (hashtable.tt_set == NULL) {
+    return;
+  }
+  if (hashtable.backing == TT_MALLOC) {
+    free(hashtable.tt_set);
+  } else if (hashtable.backing == TT_FILE) {
+    munmap(hashtable.header, hashtable.mapped_bytes);  // the file keeps it
+    hashtable.header = NULL;
+  } else {
+    munmap(hashtable.tt_set, hashtable.mapped_bytes);
+  }
+  hashtable.tt_set = NULL;
+}
+
+typedef struct {
+  int id;
+  int num_threads;
+  bool fresh;  // the memory is freshly mapped, and so zero
+} clearArgs;
+
+// Clears huge pages id, id + num_threads, id + 2 * num_threads, ... of the
+// table.  Freshly mapped pages only need touching, once every normal page.
+static void *clear_pages(void *arg) {
+  const clearArgs *args = (const clearArgs *) arg;
+  const size_t bytes = sizeof(ttSet_t) * hashtable.num_of_sets;
+  const size_t page = sysconf(_SC_PAGESIZE);
+  volatile char *mem = (volatile char *) hashtable.tt_set;
+  for (size_t start = args->id * TT_HUGE_PAGE; start < bytes;
+       start += args->num_threads * TT_HUGE_PAGE) {
+    const size_t len = bytes - start < TT_HUGE_PAGE ? bytes - start
+                                                    : TT_HUGE_PAGE;
+    if (args->fresh) {
+      for (size_t i = 0; i < len; i += page) {
+        mem[start + i] = 0;
+      }
+    } else {
+      memset((char *) mem + start, 0, len);
+    }
+  }
+  return NULL;
+}
+
+// Clears the table in parallel.  If threads cannot be started, the calling
+// thread clears their pages.
+static void clear_table(bool fresh) {
+  const size_t bytes = sizeof(ttSet_t) * hashtable.num_of_sets;
+  long num_threads = bytes / TT_CLEAR_PER_THREAD;
+  const long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+  if (num_threads > cpus) num_threads = cpus;
+  if (num_threads > TT_MAX_CLEAR_THREADS) num_threads = TT_MAX_CLEAR_THREADS;
+  if (num_threads < 1) num_threads = 1;
+
+  pthread_t threads[TT_MAX_CLEAR_THREADS];
+  bool started[TT_MAX_CLEAR_THREADS];
+  clearArgs args[TT_MAX_CLEAR_THREADS];
+  for (int i = 0; i < num_threads; i++) {
+    args[i].id = i;
+    args[i].num_threads = num_threads;
+    args[i].fresh = fresh;
+    started[i] = i > 0 &&
+        pthread_create(&threads[i], NULL, clear_pages, &args[i]) == 0;
+  }
+  for (int i = 0; i < num_threads; i++) {
+    if (!started[i]) {
+      clear_pages(&args[i]);
+    }
+  }
+  for (int i = 1; i < num_threads; i++) {
+    if (started[i]) {
+      pthread_join(threads[i], NULL);
+    }
+  }
+}
+
+const char *tt_get_backing() {
+  return backing_names[hashtable.backing];
+}
+
+bool tt_on_file() {
+  return hashtable.header != NULL;
+}
+
+// The number of sets of a table of size_in_meg megabytes, a power of 2.
+static uint64_t sets_for_size(int size_in_meg) {
   uint64_t size_in_bytes = (uint64_t) size_in_meg * (1ULL << 20);
   // total number of sets we could have in the hashtable
   uint64_t num_of_sets = size_in_bytes / sizeof(ttSet_t);
@@ -66,44 +278,282 @@ void tt_resize_hashtable(int size_in_meg) {
   uint64_t pow = 1;
   num_of_sets--;
   while (pow <= num_of_sets) pow *= 2;
-  num_of_sets = pow;
+  return pow;
+}
 
+// Replaces the table with an empty one of num_of_sets sets in memory.
+static void make_table(uint64_t num_of_sets) {
   hashtable.num_of_sets = num_of_sets;
   hashtable.mask = num_of_sets - 1;
   hashtable.age = 0;
 
-  free(hashtable.tt_set);  // free the old ones
-  hashtable.tt_set = (ttSet_t *) malloc(sizeof(ttSet_t) * num_of_sets);
-
+  unmap_table();  // free the old ones
+  hashtable.tt_set = map_table(sizeof(ttSet_t) * num_of_sets);
   if (hashtable.tt_set == NULL) {
     fprintf(stderr,  "Hash table too big\n");
     exit(1);
   }
 
-  // might as well clear the table while we are at it
-  memset(hashtable.tt_set, 0, sizeof(ttSet_t) * hashtable.num_of_sets);
+  // Mapped memory is zero already, but touching it in parallel places its
+  // pages, and faults them in now rather than during the search.
+  clear_table(hashtable.backing != TT_MALLOC);
+}
+
+// Resizing a table that is on a file would drop the file; the callers refuse.
+void tt_resize_hashtable(int size_in_meg) {
+  tbassert(!tt_on_file(), "the hash table is on a file\n");
+  make_table(sets_for_size(size_in_meg));
 }
 
 void tt_make_hashtable(int size_in_meg) {
   hashtable.tt_set = NULL;
+  hashtable.header = NULL;
   tt_resize_hashtable(size_in_meg);
 }
 
 void tt_free_hashtable() {
-  free(hashtable.tt_set);
-  hashtable.tt_set = NULL;
+  unmap_table();
 }
 
 // age the hash table by incrementing global age
 void tt_age_hashtable() {
   hashtable.age++;
+  if (hashtable.header != NULL) {
+    hashtable.header->age = hashtable.age;  // for the next engine to map it
+  }
+}
+
+static void fill_header(ttFileHeader *header) {
+  memset(header, 0, sizeof(ttFileHeader));
+  memcpy(header->magic, TT_FILE_MAGIC, sizeof(header->magic));
+  header->version = TT_FILE_VERSION;
+  header->board_width = BOARD_WIDTH;
+  header->zobrist = zob_signature();
+  header->num_of_sets = hashtable.num_of_sets;
+  header->records_per_set = RECORDS_PER_SET;
+  header->bytes_per_record = sizeof(ttRec_t);
+  header->age = hashtable.age;
+}
+
+// Checks that header is of a table this engine can use, in a file of
+// file_bytes bytes.  Returns NULL if it is, and why not otherwise.
+static const char *check_header(const ttFileHeader *header,
+                                uint64_t file_bytes) {
+  if (memcmp(header->magic, TT_FILE_MAGIC, sizeof(header->magic)) != 0) {
+    return "not a hash table file";
+  }
+  if (header->version != TT_FILE_VERSION ||
+      header->board_width != BOARD_WIDTH ||
+      header->records_per_set != RECORDS_PER_SET ||
+      header->bytes_per_record != sizeof(ttRec_t)) {
+    return "hash table of another format";
+  }
+  if (header->zobrist != zob_signature()) {
+    return "hash table of other Zobrist keys";
+  }
+  const uint64_t sets = header->num_of_sets;
+  if (sets == 0 || (sets & (sets - 1)) != 0 ||
+      file_bytes != TT_FILE_HEADER + sets * sizeof(ttSet_t)) {
+    return "hash table file of the wrong size";
+  }
+  return NULL;
+}
+
+// Sets HASH to the size of the table, after it was taken from a file.
+static void update_hash_option() {
+  HASH = (sizeof(ttSet_t) * hashtable.num_of_sets) >> 20;
+  if (HASH < 1) HASH = 1;
+}
+
+// Whether file is the one the table is mapped on.
+static bool is_table_file(const char *file) {
+  struct stat st;
+  return hashtable.header != NULL && stat(file, &st) == 0 &&
+      st.st_dev == hashtable.file_dev && st.st_ino == hashtable.file_ino;
+}
+
+const char *tt_save_hashtable(const char *file) {
+  if (is_table_file(file)) {  // it is saved already, so just flush it
+    return msync(hashtable.header, hashtable.mapped_bytes, MS_SYNC) == 0
+        ? NULL : strerror(errno);
+  }
+  FILE *f = fopen(file, "wb");
+  if (f == NULL) {
+    return strerror(errno);
+  }
+  union {
+    ttFileHeader header;
+    char bytes[TT_FILE_HEADER];
+  } page = {{{0}}};
+  fill_header(&page.header);
+  bool ok = fwrite(page.bytes, sizeof(page.bytes), 1, f) == 1 &&
+      fwrite(hashtable.tt_set, sizeof(ttSet_t), hashtable.num_of_sets, f) ==
+      hashtable.num_of_sets;
+  const char *error = ok ? NULL : strerror(errno);
+  if (fclose(f) != 0 && ok) {
+    error = strerror(errno);
+  }
+  return error;
+}
+
+const char *tt_load_hashtable(const char *file) {
+  FILE *f = fopen(file, "rb");
+  if (f == NULL) {
+    return strerror(errno);
+  }
+  struct stat st;
+  ttFileHeader header;
+  const char *error = NULL;
+  if (fstat(fileno(f), &st) != 0 ||
+      fread(&header, sizeof(header), 1, f) != 1) {
+    error = "cannot read the hash table header";
+  } else {
+    error = check_header(&header, st.st_size);
+  }
+  if (error != NULL) {
+    fclose(f);
+    return error;
+  }
+
+  make_table(header.num_of_sets);
+  if (fseek(f, TT_FILE_HEADER, SEEK_SET) != 0 ||
+      fread(hashtable.tt_set, sizeof(ttSet_t), hashtable.num_of_sets, f) !=
+      hashtable.num_of_sets) {
+    clear_table(false);  // rather than half a table
+    error = "cannot read the hash table";
+  } else {
+    hashtable.age = header.age;
+  }
+  fclose(f);
+  update_hash_option();
+  return error;
+}
+
+const char *tt_map_hashtable_file(const char *file) {
+  int fd = open(file, O_RDWR | O_CREAT, 0644);
+  if (fd < 0) {
+    return strerror(errno);
+  }
+  struct stat st;
+  if (fstat(fd, &st) != 0) {
+    close(fd);
+    return strerror(errno);
+  }
+
+  // A new (empty) file gets an empty table of the size of the hash option.
+  ttFileHeader header;
+  const bool fresh = st.st_size == 0;
+  uint64_t num_of_sets;
+  if (fresh) {
+    num_of_sets = sets_for_size(HASH);
+    if (ftruncate(fd, TT_FILE_HEADER + num_of_sets * sizeof(ttSet_t)) != 0) {
+      const char *error = strerror(errno);
+      close(fd);
+      return error;
+    }
+  } else {
+    const char *error = NULL;
+    if (pread(fd, &header, sizeof(header), 0) != sizeof(header)) {
+      error = "cannot read the hash table header";
+    } else {
+      error = check_header(&header, st.st_size);
+    }
+    if (error != NULL) {
+      close(fd);
+      return error;
+    }
+    num_of_sets = header.num_of_sets;
+  }
+
+  const size_t bytes = TT_FILE_HEADER + num_of_sets * sizeof(ttSet_t);
+  void *mem = mmap(NULL, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  const char *error = mem == MAP_FAILED ? strerror(errno) : NULL;
+  if (error != NULL && fresh) {
+    ftruncate(fd, 0);  // leave no file without a header
+  }
+  close(fd);  // the mapping keeps the file
+  if (error != NULL) {
+    return error;
+  }
+#ifdef MADV_WILLNEED
+  madvise(mem, bytes, MADV_WILLNEED);  // read it in now, not during a search
+#endif
+
+  unmap_table();
+  hashtable.header = (ttFileHeader *) mem;
+  hashtable.tt_set = (ttSet_t *) ((char *) mem + TT_FILE_HEADER);
+  hashtable.mapped_bytes = bytes;
+  hashtable.backing = TT_FILE;
+  hashtable.file_dev = st.st_dev;
+  hashtable.file_ino = st.st_ino;
+  hashtable.num_of_sets = num_of_sets;
+  hashtable.mask = num_of_sets - 1;
+  if (fresh) {
+    hashtable.age = 0;
+    fill_header(hashtable.header);
+  } else {
+    hashtable.age = header.age;
+  }
+  update_hash_option();
+  return NULL;
 }
 
 void tt_clear_hashtable() {
-  memset(hashtable.tt_set, 0, sizeof(ttSet_t) * hashtable.num_of_sets);
+  clear_table(false);
   hashtable.age = 0;
 }
 
+// Permille of the records in the first 1000 sets (or all of them, if fewer)
+// written by the current search, as the UCI "hashfull".
+int tt_hashfull() {
+  const uint64_t sets = hashtable.num_of_sets < 1000 ? hashtable.num_of_sets
+                                                      : 1000;
+  uint64_t used = 0;
+  for (uint64_t i = 0; i < sets; i++) {
+    for (int j = 0; j < RECORDS_PER_SET; j++) {
+      const ttRec_t *rec = &hashtable.tt_set[i].records[j];
+      used += rec->key != 0 && age_of(rec) == 0;
+    }
+  }
+  return 1000 * used / (sets * RECORDS_PER_SET);
+}
+
+#if TT_STATS
+// Probes, hits and torn records seen, for benchmarking the table; see the
+// Makefile.  A record is taken to be torn when its key, as read, does not
+// belong in its set; this misses 1 torn record in num_of_sets.
+static uint64_t tt_probes, tt_hits, tt_torn;
+
+void tt_get_stats(uint64_t *probes, uint64_t *hits, uint64_t *torn) {
+  *probes = __atomic_load_n(&tt_probes, __ATOMIC_RELAXED);
+  *hits = __atomic_load_n(&tt_hits, __ATOMIC_RELAXED);
+  *torn = __atomic_load_n(&tt_torn, __ATOMIC_RELAXED);
+}
+
+void tt_reset_stats() {
+  __atomic_store_n(&tt_probes, 0, __ATOMIC_RELAXED);
+  __atomic_store_n(&tt_hits, 0, __ATOMIC_RELAXED);
+  __atomic_store_n(&tt_torn, 0, __ATOMIC_RELAXED);
+}
+#endif
+
+// Reads the record at rec in the table into *copy, with its key decoded.
+static void read_record(const ttRec_t *rec, ttRec_t *copy,
+                        uint64_t set_index) {
+  copy->data = __atomic_load_n(&rec->data, __ATOMIC_RELAXED);
+  copy->key = __atomic_load_n(&rec->key, __ATOMIC_RELAXED) ^ copy->data;
+#if TT_STATS
+  if (copy->key != 0 && (copy->key & hashtable.mask) != set_index) {
+    __atomic_fetch_add(&tt_torn, 1, __ATOMIC_RELAXED);
+  }
+#endif
+}
+
+static void write_record(ttRec_t *rec, uint64_t key, uint64_t data) {
+  __atomic_store_n(&rec->key, key ^ data, __ATOMIC_RELAXED);
+  __atomic_store_n(&rec->data, data, __ATOMIC_RELAXED);
+}
+
 
 void tt_hashtable_put(uint64_t key, int depth, score_t score,
                       int bound_type, move_t move) {
@@ -113,65 +563,67 @@ void tt_hashtable_put(uint64_t key, int depth, score_t score,
   // current record that we are looking into
   ttRec_t *curr_rec = hashtable.tt_set[set_index].records;
   // best record to replace that we found so far
-  ttRec_t *rec_to_replace = curr_rec;
-  int replacemt_val = -99;            // value of doing the replacement
+  ttRec_t *rec_to_replace = NULL;
+  int replacemt_val = INT32_MAX;      // value of keeping it
 
   move = move & MOVE_MASK;
 
   for (int i = 0; i < RECORDS_PER_SET; i++, curr_rec++) {
-    int value = 0;  // points for sorting
+    ttRec_t rec;
+    read_record(curr_rec, &rec, set_index);
 
     // always use entry if it's not used or has same key
-    if (!curr_rec->key || key == curr_rec->key) {
-      if (move == 0) {
-        move = curr_rec->move;
+    if (!rec.key || key == rec.key) {
+      if (move == 0 && rec.key) {
+        move = tt_move_of(&rec);
       }
-      curr_rec->key = key;
-      curr_rec->quality = depth;
-      curr_rec->move = move;
-      curr_rec->age = hashtable.age;
-      curr_rec->score = score;
-      curr_rec->bound = (ttBound_t) bound_type;
-
-      return;
+      rec_to_replace = curr_rec;
+      break;
     }
 
-    // otherwise, potential candidate for replacement
-    if (curr_rec->age == hashtable.age) {
-      value -= 6;   // prefer not to replace if same age
-    }
-    if (curr_rec->quality < rec_to_replace->quality) {
-      value += 1;   // prefer to replace if worse quality
-    }
-    if (value > replacemt_val) {
+    // otherwise, replace the shallowest of the oldest records
+    int value = depth_of(&rec) - TT_AGE_WEIGHT * (int) age_of(&rec);
+    if (value < replacemt_val) {
       replacemt_val = value;
       rec_to_replace = curr_rec;
     }
   }
-  // update the record that we are replacing with this record
-  rec_to_replace->key = key;
-  rec_to_replace->quality = depth;
-  rec_to_replace->move = move;
-  rec_to_replace->age = hashtable.age;
-  rec_to_replace->score = score;
-  rec_to_replace->bound = (ttBound_t) bound_type;
+
+  write_record(rec_to_replace, key, pack_data(move, score, depth,
+                                              (ttBound_t) bound_type,
+                                              hashtable.age));
 }
 
 
-ttRec_t *tt_hashtable_get(uint64_t key) {
+// Starts loading the set of key into the cache, so that a tt_hashtable_get()
+// or tt_hashtable_put() of key soon after does not wait on memory.
+void tt_prefetch(uint64_t key) {
+  __builtin_prefetch(&hashtable.tt_set[key & hashtable.mask]);
+}
+
+// Copies the record of key into *rec, if there is one.
+bool tt_hashtable_get(uint64_t key, ttRec_t *rec) {
   if (!USE_TT) {
-    return NULL;  // done if we are not using the transposition table
+    return false;  // done if we are not using the transposition table
   }
 
   uint64_t set_index = key & hashtable.mask;
-  ttRec_t *rec = hashtable.tt_set[set_index].records;
+  const ttRec_t *curr_rec = hashtable.tt_set[set_index].records;
 
-  ttRec_t *found = NULL;
-  for (int i = 0; i < RECORDS_PER_SET; i++, rec++) {
+  bool found = false;
+  for (int i = 0; i < RECORDS_PER_SET; i++, curr_rec++) {
+    read_record(curr_rec, rec, set_index);
     if (rec->key == key) {  // found the record that we are looking for
-      found = rec;
+      found = true;
+      break;
     }
   }
+#if TT_STATS
+  __atomic_fetch_add(&tt_probes, 1, __ATOMIC_RELAXED);
+  if (found) {
+    __atomic_fetch_add(&tt_hits, 1, __ATOMIC_RELAXED);
+  }
+#endif
   return found;
 }
 
@@ -189,7 +641,7 @@ score_t lose_in(int ply) {
 // when you retrieve the score from the hashtable, however, you want to
 // consider the value of the position based on where you are in the search tree
 score_t tt_adjust_score_from_hashtable(ttRec_t *rec, int ply_in_search) {
-  score_t score = rec->score;
+  score_t score = tt_score_of(rec);
   if (score >= win_in(MAX_PLY_IN_SEARCH)) {
     return score - ply_in_search;
   }
@@ -215,14 +667,15 @@ score_t tt_adjust_score_for_hashtable(score_t score, int ply_in_search) {
 bool tt_is_usable(ttRec_t *tt, int depth, score_t beta) {
   // can't use this record if we are searching at depth higher than the
   // depth of this record.
-  if (tt->quality < depth) {
+  if (depth_of(tt) < depth) {
     return false;
   }
   // otherwise check whether the score falls within the bounds
-  if ((tt->bound == LOWER) && tt->score >= beta) {
+  const score_t score = tt_score_of(tt);
+  if ((bound_of(tt) == LOWER) && score >= beta) {
     return true;
   }
-  if ((tt->bound == UPPER) && tt->score < beta) {
+  if ((bound_of(tt) == UPPER) && score < beta) {
     return true;
   }
 
@@ -21,9 +21,12 @@ typedef enum {
   EXACT
 } ttBound_t;
 
-// Just forward declarations
-// The real definition is in tt.c
-typedef struct ttRec ttRec_t;
+// A record: the key, and the data packed as described in tt.c.  Probes
+// copy the record out of the table, since other threads may be writing it.
+typedef struct ttRec {
+  uint64_t key;
+  uint64_t data;
+} ttRec_t;
 
 // accessor methods for accessing move and score recorded in ttRec_t
 move_t tt_move_of(ttRec_t *tt);
@@ -31,17 +34,35 @@ score_t tt_score_of(ttRec_t *tt);
 
 size_t tt_get_bytes_per_record();
 uint32_t tt_get_num_of_records();
+const char *tt_get_backing();  // what memory the table is on
+bool tt_on_file();  // whether the table is mapped on a file
 
 // operations on the global hashtable
 void tt_make_hashtable(int sizeMeg);
 void tt_resize_hashtable(int sizeInMeg);
 void tt_free_hashtable();
 void tt_age_hashtable();
+int tt_hashfull();
+
+// Saving the table to a file, loading it from one, and mapping it on one so
+// that it persists from one run of the engine to the next.  Loading or
+// mapping a table also sets the hash option to its size.  Each returns NULL
+// on success and why it failed otherwise.
+const char *tt_save_hashtable(const char *file);
+const char *tt_load_hashtable(const char *file);
+const char *tt_map_hashtable_file(const char *file);
+
+#if TT_STATS
+// probe, hit and torn record counts, kept only in builds with TT_STATS=1
+void tt_get_stats(uint64_t *probes, uint64_t *hits, uint64_t *torn);
+void tt_reset_stats();
+#endif
 
 // putting / getting transposition data into / from hashtable
 void tt_hashtable_put(uint64_t key, int depth, score_t score,
                       int type, move_t move);
-ttRec_t *tt_hashtable_get(uint64_t key);
+bool tt_hashtable_get(uint64_t key, ttRec_t *rec);
+void tt_prefetch(uint64_t key);  // a probe of key is coming
 
 score_t tt_adjust_score_from_hashtable(ttRec_t *rec, int ply);
 score_t tt_adjust_score_for_hashtable(score_t score, int ply);
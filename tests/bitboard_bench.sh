@@ -0,0 +1,44 @@
+#!/bin/sh
+# Compares an engine built with bitboards (the default) with one built with
+# "make BITBOARDS=0", on the move generator alone ("perft") and on the
+# search, by the time a deterministic "bench" takes.  Both builds search the
+# same tree, so their bench node counts, printed alongside, must agree.
+#
+# Usage: ./bitboard_bench.sh <mailbox_engine> [depth] [perft_depth] [engine]
+#        depth defaults to 6, perft_depth to 5 and the engine to
+#        ../player/leiserchess.  Each is run 3 times and the best time kept.
+#
+# For example, from player/:
+#   make clean && make BITBOARDS=0 NAME=leiserchess_mailbox && make clean && make
+#   ../tests/bitboard_bench.sh ./leiserchess_mailbox
+
+MAILBOX=$1
+DEPTH=${2:-6}
+PERFT_DEPTH=${3:-5}
+ENGINE=${4:-$(dirname "$0")/../player/leiserchess}
+
+if [ -z "$MAILBOX" ]; then
+  echo "usage: $0 <mailbox_engine> [depth] [perft_depth] [engine]" >&2
+  exit 1
+fi
+
+# best_time <engine> <commands> <pattern> <field>: the least of 3 runs of the
+# given field of the output line matching pattern.
+best_time() {
+  for run in 1 2 3; do
+    printf "$2" | "$1" | grep "$3" | tail -1 | awk -v f="$4" '{print $f}'
+  done | sort -n | head -1
+}
+
+printf "%-9s %14s %14s %14s\n" build "perft(ms)" "bench(ms)" "bench nodes"
+for build in bitboards mailbox; do
+  engine=$ENGINE
+  [ "$build" = mailbox ] && engine=$MAILBOX
+  perft=$(best_time "$engine" "perft $PERFT_DEPTH\nquit\n" "^perft *$PERFT_DEPTH " 5)
+  bench=$(best_time "$engine" \
+          "setoption name deterministic value 1\nbench $DEPTH\nquit\n" \
+          "^bench" 9)
+  nodes=$(printf "setoption name deterministic value 1\nbench $DEPTH\nquit\n" |
+          "$engine" | grep "^bench" | tail -1 | awk '{print $7}')
+  printf "%-9s %14s %14s %14s\n" "$build" "$perft" "$bench" "$nodes"
+done
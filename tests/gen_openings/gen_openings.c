@@ -110,8 +110,6 @@ static int_options iopts[] = {
 // Printing helpers
 // -----------------------------------------------------------------------------
 
-void getPV(move_t *pv, char *buf);
-
 int file_exists(const char *filename) {
   struct stat sbuf;
   return stat(filename, &sbuf) == 0;
@@ -174,6 +172,8 @@ static pthread_mutex_t entry_mutex;
 //static Speculative_add node_count_parallel;
 static uint64_t node_count_serial;
 
+static searchContext context;
+
 typedef struct {
   position_t *p;
   int depth;
@@ -193,16 +193,15 @@ void *entry_point(void *arg) {
   // start time of search
   init_abort_timer(tme);
 
-  init_best_move_history();
   tt_age_hashtable();
-
-  init_tics();
+  init_search_context(&context, p, false);
 
   for (int d = 1; d <= depth; d++) {  // Iterative deepening
     reset_abort();
 
-    searchRoot(p, -INF, INF, d, 0, subpv, &node_count_serial,
-                OUT);
+    searchRoot(&context, p, -INF, INF, d, 0, subpv, &node_count_serial,
+               OUT);
+    merge_search_tables(&context);
 
     et = elapsed_time();
 
@@ -439,6 +438,7 @@ int main(int argc, char *argv[]) {
 
   init_options();
   init_zob();
+  init_bitboards();
 
 
   ///////////////////////////////////////////////////////////////////////////
@@ -467,6 +467,14 @@ int main(int argc, char *argv[]) {
     int depth = GENOPENING_DEPTH;
 
     tt_make_hashtable(HASH);    // initial hash table
+
+    // The end position of every line is also streamed here in the 32-byte
+    // packed format, for tools that want positions rather than move lists.
+    FILE *packed_out = fopen("openings.pos", "wb");
+    if (packed_out == NULL) {
+      fprintf(stderr, "Cannot open openings.pos for writing.\n");
+      exit(1);
+    }
     int lines;
     for (lines = 0; lines < BOOKLINES; lines++) {
    try_again:
@@ -499,7 +507,14 @@ int main(int argc, char *argv[]) {
       }
       printf("OPEN: %s\n", opn);
       fflush(stdout);
+      packed_position_t packed;
+      pack_position(&gme[MAX_BOOKMOVES], &packed);
+      if (fwrite(&packed, sizeof(packed_position_t), 1, packed_out) != 1) {
+        fprintf(stderr, "Cannot write openings.pos.\n");
+        exit(1);
+      }
     }
+    fclose(packed_out);
     fprintf(stderr, "Done gen opening %d lines.\n", lines);
   }
 #endif /* GEN_OPENINGS */
@@ -545,10 +560,7 @@ int main(int argc, char *argv[]) {
           n = 2;
         } else if (strcmp(tok[1], "endgame") == 0) {
           ix = 0;
-          if (BOARD_WIDTH == 10)
-            fen_to_pos(&gme[ix], "ss9/10/10/10/10/10/10/10/10/9NN W");
-          else if (BOARD_WIDTH == 8)
-            fen_to_pos(&gme[ix], "ss7/8/8/8/8/8/8/7NN W");
+          fen_to_pos(&gme[ix], ENDGAME_FEN);
           n = 2;
         } else if (strcmp(tok[1], "fen") == 0) {
           if (token_count < 3) {  // no input
@@ -775,7 +787,7 @@ int main(int argc, char *argv[]) {
         if (token_count >= 2) {  // Takes a depth argument to test deeper
           depth = strtol(tok[1], (char **)NULL, 10);
         }
-        do_perft(gme, depth, 0);
+        do_perft(gme, depth, 0, false, false, 0);
         continue;
       }
 
@@ -0,0 +1,27 @@
+#!/bin/sh
+# Compares the time to depth and the nodes per second of the Cilk search and
+# of Lazy SMP on 1, 2, 4, ... cores, using the engine's "bench" command.
+#
+# Usage: ./smp_bench.sh [depth] [max_cores] [engine]
+#        depth defaults to 5, max_cores to 64 and the engine to
+#        ../player/leiserchess.
+
+DEPTH=${1:-5}
+MAX_CORES=${2:-64}
+ENGINE=${3:-$(dirname "$0")/../player/leiserchess}
+
+printf "%-6s %-9s %12s %10s %10s\n" cores mode nodes "time(ms)" nps
+n=1
+while [ "$n" -le "$MAX_CORES" ]; do
+  cilk=$(printf "bench %d\nquit\n" "$DEPTH" |
+         CILK_NWORKERS=$n "$ENGINE" | grep '^bench')
+  lazy=$(printf "setoption name lazy_smp value 1\nsetoption name threads value %d\nbench %d\nquit\n" \
+         "$n" "$DEPTH" | "$ENGINE" | grep '^bench')
+  for line in "$cilk" "$lazy"; do
+    echo "$line" | awk -v n="$n" '{
+      for (i = 1; i < NF; i++) v[$i] = $(i + 1)
+      printf "%-6d %-9s %12s %10s %10s\n", n, v["mode"], v["nodes"], v["time"], v["nps"]
+    }'
+  done
+  n=$((n * 2))
+done
@@ -0,0 +1,27 @@
+#!/bin/sh
+# Measures the transposition table at sizes from 16 MB to 4 GB, using the
+# engine's "bench" command: the nodes and nodes per second, and, when the
+# engine is built with TT_STATS=1, the hit rate and how full the table got.
+#
+# Usage: ./tt_bench.sh [depth] [max_mb] [engine]
+#        depth defaults to 6, max_mb to 4096 and the engine to
+#        ../player/leiserchess.
+
+DEPTH=${1:-6}
+MAX_MB=${2:-4096}
+ENGINE=${3:-$(dirname "$0")/../player/leiserchess}
+
+printf "%-6s %12s %10s %10s %9s %9s\n" MB nodes "time(ms)" nps "hit(%)" hashfull
+mb=16
+while [ "$mb" -le "$MAX_MB" ]; do
+  printf "setoption name hash value %d\nbench %d\nquit\n" "$mb" "$DEPTH" |
+    "$ENGINE" | grep -e '^bench' -e '^info hash' | awk -v mb="$mb" '{
+      for (i = 1; i < NF; i++) v[$i] = $(i + 1)
+    }
+    END {
+      printf "%-6d %12s %10s %10s %9s %9s\n", mb, v["nodes"], v["time"],
+             v["nps"], v["hit_rate"] == "" ? "-" : v["hit_rate"],
+             v["hashfull"] == "" ? "-" : v["hashfull"]
+    }'
+  mb=$((mb * 4))
+done
@@ -0,0 +1,29 @@
+#!/bin/sh
+# Stresses the lockless hash table: runs the parallel searches on a small
+# table, where the threads write the same records all the time, and reports
+# how many torn records the probes detected (and so ignored).  The engine
+# must be built with TT_STATS=1.
+#
+# Usage: ./tt_stress.sh [depth] [threads] [engine]
+#        depth defaults to 6, threads to 8 and the engine to
+#        ../player/leiserchess.
+
+DEPTH=${1:-6}
+THREADS=${2:-8}
+ENGINE=${3:-$(dirname "$0")/../player/leiserchess}
+
+printf "%-9s %-7s %12s %12s %8s\n" mode threads probes hits torn
+for mode in cilk lazy_smp; do
+  if [ "$mode" = cilk ]; then
+    options=""
+  else
+    options="setoption name lazy_smp value 1
+setoption name threads value $THREADS"
+  fi
+  printf "setoption name hash value 1\n%s\nbench %d\nquit\n" "$options" "$DEPTH" |
+    CILK_NWORKERS=$THREADS "$ENGINE" | grep '^info hash' |
+    awk -v mode="$mode" -v n="$THREADS" '{
+      for (i = 1; i < NF; i++) v[$i] = $(i + 1)
+      printf "%-9s %-7d %12s %12s %8s\n", mode, n, v["probes"], v["hits"], v["torn"]
+    }'
+done